@@ -0,0 +1,106 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include <nanobench.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+
+#include <lexy/action/parse.hpp>
+#include <lexy/callback.hpp>
+#include <lexy/dsl.hpp>
+#include <lexy/input/string_input.hpp>
+
+namespace grammar
+{
+namespace dsl = lexy::dsl;
+
+struct number
+{
+    static constexpr auto rule  = dsl::minus_sign + dsl::floating_point<double>;
+    static constexpr auto value = lexy::as_floating_point<double>;
+};
+
+// Sums a comma separated list of numbers.
+struct numbers
+{
+    static constexpr auto rule = dsl::list(dsl::p<number>, dsl::sep(dsl::comma)) + dsl::eof;
+    static constexpr auto value
+        = lexy::fold_inplace<double>(0.0, [](double& sum, double value) { sum += value; });
+};
+} // namespace grammar
+
+double float_lexy(const std::string& input)
+{
+    auto result = lexy::parse<grammar::numbers>(lexy::string_input(input), lexy::noop);
+    return result.value();
+}
+
+double float_strtod(const std::string& input)
+{
+    auto sum = 0.0;
+    for (auto ptr = input.c_str(); *ptr != '\0';)
+    {
+        char* end = nullptr;
+        sum += std::strtod(ptr, &end);
+        ptr = *end == ',' ? end + 1 : end;
+    }
+    return sum;
+}
+
+// Coordinate pairs with full precision, like in canada.json.
+std::string canada_data(std::size_t count)
+{
+    std::mt19937                           engine(42);
+    std::uniform_real_distribution<double> longitude(-141.0, -52.0);
+    std::uniform_real_distribution<double> latitude(41.0, 83.0);
+
+    std::string result;
+    char        buffer[64];
+    for (auto i = 0u; i != count; ++i)
+    {
+        std::snprintf(buffer, sizeof(buffer), "%.17g,%.17g,", longitude(engine), latitude(engine));
+        result += buffer;
+    }
+    result.pop_back();
+    return result;
+}
+
+// Short numbers with few digits, like prices or measurements.
+std::string short_data(std::size_t count)
+{
+    std::mt19937                       engine(42);
+    std::uniform_int_distribution<int> digits(0, 99999);
+    std::uniform_int_distribution<int> scale(0, 3);
+
+    std::string result;
+    char        buffer[64];
+    for (auto i = 0u; i != count; ++i)
+    {
+        std::snprintf(buffer, sizeof(buffer), "%.*f,", scale(engine), digits(engine) / 100.0);
+        result += buffer;
+    }
+    result.pop_back();
+    return result;
+}
+
+int main()
+{
+    ankerl::nanobench::Bench b;
+
+    auto bench_data = [&](const char* title, const std::string& data) {
+        b.title(title).relative(true);
+        b.unit("byte").batch(data.size());
+        b.minEpochIterations(10);
+
+        b.run("strtod", [&] { return float_strtod(data); });
+        b.run("lexy", [&] { return float_lexy(data); });
+    };
+
+    bench_data("canada", canada_data(100 * 1000));
+    bench_data("short", short_data(100 * 1000));
+}
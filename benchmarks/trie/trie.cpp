@@ -0,0 +1,22 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <lexy/_detail/nttp_string.hpp>
+#include <lexy/engine/trie.hpp>
+#include <lexy/input/string_input.hpp>
+
+// The keywords are generated by CMake.
+constexpr auto keywords = lexy::trie<char,
+#include <keywords.inc>
+                                     >;
+
+// Also instantiate the matching code.
+std::size_t match_keyword(const char* str, std::size_t size)
+{
+    auto input  = lexy::string_input(str, size);
+    auto reader = input.reader();
+
+    lexy::engine_trie<keywords>::error_code ec{};
+    return lexy::engine_trie<keywords>::parse(ec, reader);
+}
@@ -0,0 +1,27 @@
+#include <lexy/action/parse.hpp>
+#include <lexy/callback.hpp>
+#include <lexy/dsl.hpp>
+#include <lexy_ext/compiler_explorer.hpp>
+#include <lexy_ext/report_error.hpp>
+
+namespace dsl = lexy::dsl;
+
+//{
+struct production
+{
+    // Sign followed by a decimal number with optional fraction and exponent.
+    static constexpr auto rule  = dsl::sign + dsl::floating_point<double>;
+    static constexpr auto value = lexy::as_floating_point<double>;
+};
+//}
+
+int main()
+{
+    auto input  = lexy_ext::compiler_explorer_input();
+    auto result = lexy::parse<production>(input, lexy_ext::report_error);
+    if (!result.has_value())
+        return 1;
+
+    std::printf("The value is: %g\n", result.value());
+    return result ? 0 : 1;
+}
@@ -0,0 +1,264 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef LEXY_DETAIL_BYTE_SET_HPP_INCLUDED
+#define LEXY_DETAIL_BYTE_SET_HPP_INCLUDED
+
+#include <lexy/_detail/config.hpp>
+#include <lexy/_detail/integer_sequence.hpp>
+#include <lexy/_detail/swar.hpp>
+
+namespace lexy::_detail
+{
+// An inclusive range of code units.
+struct byte_range
+{
+    unsigned char min, max;
+};
+
+// A set of code units of a single-byte encoding, stored as a 256 bit bitmap.
+class byte_set
+{
+public:
+    constexpr byte_set() : _bits() {}
+
+    static constexpr byte_set all()
+    {
+        byte_set result;
+        for (auto& bits : result._bits)
+            bits = std::uint_least32_t(0xFFFF'FFFF);
+        return result;
+    }
+
+    constexpr byte_set& insert(unsigned char c)
+    {
+        _bits[c / 32] |= std::uint_least32_t(1) << (c % 32);
+        return *this;
+    }
+    constexpr byte_set& insert(unsigned char min, unsigned char max)
+    {
+        for (auto c = unsigned(min); c <= max; ++c)
+            insert(static_cast<unsigned char>(c));
+        return *this;
+    }
+    constexpr byte_set& insert(const byte_set& other)
+    {
+        for (auto i = 0u; i != 8u; ++i)
+            _bits[i] |= other._bits[i];
+        return *this;
+    }
+
+    constexpr bool contains(unsigned char c) const
+    {
+        return (_bits[c / 32] & (std::uint_least32_t(1) << (c % 32))) != 0;
+    }
+
+    constexpr std::size_t size() const
+    {
+        auto result = std::size_t(0);
+        for (auto c = 0u; c != 256u; ++c)
+            if (contains(static_cast<unsigned char>(c)))
+                ++result;
+        return result;
+    }
+    constexpr bool is_all() const
+    {
+        return size() == 256;
+    }
+
+    // Returns the nth code unit in the set, ordered by value.
+    constexpr unsigned char nth(std::size_t n) const
+    {
+        for (auto c = 0u; c != 256u; ++c)
+            if (contains(static_cast<unsigned char>(c)) && n-- == 0)
+                return static_cast<unsigned char>(c);
+        return 0;
+    }
+
+    // Returns the number of maximal ranges of consecutive code units in the set.
+    constexpr std::size_t range_count() const
+    {
+        auto result = std::size_t(0);
+        for (auto c = 0u; c != 256u; ++c)
+            if (contains(static_cast<unsigned char>(c))
+                && (c == 0 || !contains(static_cast<unsigned char>(c - 1))))
+                ++result;
+        return result;
+    }
+
+    // Returns the nth maximal range of consecutive code units, ordered by value.
+    constexpr byte_range nth_range(std::size_t n) const
+    {
+        auto c = 0u;
+        while (true)
+        {
+            // Skip to the beginning of the next range.
+            while (c != 256u && !contains(static_cast<unsigned char>(c)))
+                ++c;
+            if (c == 256u)
+                return {0, 0};
+
+            auto min = c;
+            while (c != 256u && contains(static_cast<unsigned char>(c)))
+                ++c;
+
+            if (n-- == 0)
+                return {static_cast<unsigned char>(min), static_cast<unsigned char>(c - 1)};
+        }
+    }
+
+private:
+    std::uint_least32_t _bits[8];
+};
+
+// Inserts the character of a string literal into the set, if it can be represented by one byte.
+template <typename CharT>
+constexpr void insert_char(byte_set& set, CharT c)
+{
+    if constexpr (sizeof(CharT) == 1)
+        set.insert(static_cast<unsigned char>(c));
+    else if constexpr (std::is_signed_v<CharT>)
+    {
+        if (0 <= c && c <= 0xFF)
+            set.insert(static_cast<unsigned char>(c));
+    }
+    else if (c <= 0xFF)
+        set.insert(static_cast<unsigned char>(c));
+}
+} // namespace lexy::_detail
+
+namespace lexy::_detail
+{
+template <const auto& Set, std::size_t... Idx>
+constexpr swar_int _find_mask(swar_int word, index_sequence<Idx...>)
+{
+    constexpr unsigned char chars[] = {Set.nth(Idx)...};
+    return (swar_char_mask(word, chars[Idx]) | ...);
+}
+
+// Returns the first position in [cur, end) whose code unit is in the set, or end.
+// If Padding is at least swar_length, a word can be loaded starting at any position <= end.
+template <const auto& Set, std::size_t Padding = 0, typename CharT>
+constexpr const CharT* find_first_of(const CharT* cur, const CharT* end)
+{
+    static_assert(sizeof(CharT) == 1);
+    constexpr auto size = Set.size();
+
+    if constexpr (size == 0)
+    {
+        // Nothing can match.
+        return end;
+    }
+    else if constexpr (size <= 4)
+    {
+        // Few enough code units that we can compare against all of them word-at-a-time.
+        using idx_seq = make_index_sequence<size>;
+        if constexpr (Padding >= swar_length)
+        {
+            // We don't need to handle the tail separately, a match in the padding is ignored.
+            for (; cur < end; cur += swar_length)
+            {
+                auto mask = _find_mask<Set>(swar_load(cur), idx_seq{});
+                if (mask != 0)
+                {
+                    auto pos = cur + swar_find_first(mask);
+                    return pos < end ? pos : end;
+                }
+            }
+            return end;
+        }
+        else
+        {
+            while (end - cur >= std::ptrdiff_t(swar_length))
+            {
+                auto mask = _find_mask<Set>(swar_load(cur), idx_seq{});
+                if (mask != 0)
+                    return cur + swar_find_first(mask);
+
+                cur += swar_length;
+            }
+
+            while (cur != end && !Set.contains(static_cast<unsigned char>(*cur)))
+                ++cur;
+            return cur;
+        }
+    }
+    else if constexpr (size < 256)
+    {
+        // Use the bitmap.
+        while (cur != end && !Set.contains(static_cast<unsigned char>(*cur)))
+            ++cur;
+        return cur;
+    }
+    else
+    {
+        // Everything matches.
+        return cur;
+    }
+}
+
+template <const auto& Set, std::size_t... Idx>
+constexpr swar_int _range_mask(swar_int word, index_sequence<Idx...>)
+{
+    constexpr byte_range ranges[] = {Set.nth_range(Idx)...};
+    return (swar_range_mask(word, ranges[Idx].min, ranges[Idx].max) | ...);
+}
+
+// Returns the first position in [cur, end) whose code unit is not in the set, or end.
+// Padding has the same meaning as for find_first_of().
+template <const auto& Set, std::size_t Padding = 0, typename CharT>
+constexpr const CharT* find_first_not_of(const CharT* cur, const CharT* end)
+{
+    static_assert(sizeof(CharT) == 1);
+    constexpr auto range_count = Set.range_count();
+
+    if constexpr (range_count == 0)
+    {
+        // Nothing is in the set.
+        return cur;
+    }
+    else if constexpr (range_count <= 4 && Set.nth_range(range_count - 1).max <= 0x7F)
+    {
+        // Few enough ASCII ranges that we can classify a word at once.
+        using idx_seq = make_index_sequence<range_count>;
+        if constexpr (Padding >= swar_length)
+        {
+            // The padding is never in the set, so we always stop at end.
+            for (;; cur += swar_length)
+            {
+                auto mask = ~_range_mask<Set>(swar_load(cur), idx_seq{}) & swar_fill(0x80);
+                if (mask != 0)
+                {
+                    auto pos = cur + swar_find_first(mask);
+                    return pos < end ? pos : end;
+                }
+            }
+        }
+        else
+        {
+            while (end - cur >= std::ptrdiff_t(swar_length))
+            {
+                auto mask = ~_range_mask<Set>(swar_load(cur), idx_seq{}) & swar_fill(0x80);
+                if (mask != 0)
+                    return cur + swar_find_first(mask);
+
+                cur += swar_length;
+            }
+
+            while (cur != end && Set.contains(static_cast<unsigned char>(*cur)))
+                ++cur;
+            return cur;
+        }
+    }
+    else
+    {
+        // Use the bitmap.
+        while (cur != end && Set.contains(static_cast<unsigned char>(*cur)))
+            ++cur;
+        return cur;
+    }
+}
+} // namespace lexy::_detail
+
+#endif // LEXY_DETAIL_BYTE_SET_HPP_INCLUDED
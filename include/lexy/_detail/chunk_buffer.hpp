@@ -0,0 +1,170 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef LEXY_DETAIL_CHUNK_BUFFER_HPP_INCLUDED
+#define LEXY_DETAIL_CHUNK_BUFFER_HPP_INCLUDED
+
+#include <cstring>
+#include <lexy/_detail/assert.hpp>
+#include <lexy/_detail/config.hpp>
+
+namespace lexy::_detail
+{
+// Memory that is filled incrementally and handed out in chunks that end after a delimiter.
+// The data consists of the current chunk, followed by the beginning of the next one.
+// It only grows if a single record between two delimiters doesn't fit.
+class chunk_buffer
+{
+public:
+    chunk_buffer() noexcept : _data(nullptr), _capacity(0), _size(0), _end(0), _searched(0) {}
+
+    explicit chunk_buffer(std::size_t capacity) : chunk_buffer()
+    {
+        LEXY_PRECONDITION(capacity > 0);
+        _data     = new char[capacity];
+        _capacity = capacity;
+    }
+
+    chunk_buffer(chunk_buffer&& other) noexcept : chunk_buffer()
+    {
+        *this = LEXY_MOV(other);
+    }
+
+    ~chunk_buffer() noexcept
+    {
+        delete[] _data;
+    }
+
+    chunk_buffer& operator=(chunk_buffer&& other) noexcept
+    {
+        _detail::swap(_data, other._data);
+        _detail::swap(_capacity, other._capacity);
+        _detail::swap(_size, other._size);
+        _detail::swap(_end, other._end);
+        _detail::swap(_searched, other._searched);
+        return *this;
+    }
+
+    //=== data ===//
+    const char* data() const noexcept
+    {
+        return _data;
+    }
+    std::size_t size() const noexcept
+    {
+        return _size;
+    }
+
+    // Removes the first n characters of the data, which must not be part of a chunk yet.
+    void erase_front(std::size_t n) noexcept
+    {
+        LEXY_PRECONDITION(_end == 0 && n <= _size);
+        _size -= n;
+        _searched = _searched > n ? _searched - n : 0;
+        std::memmove(_data, _data + n, _size);
+    }
+
+    // The memory after the data, which can be written to.
+    // It grows the memory first if there is none, invalidating all pointers.
+    char* write_data()
+    {
+        if (_size == _capacity)
+            _grow();
+        return _data + _size;
+    }
+    std::size_t write_size() const noexcept
+    {
+        return _capacity - _size;
+    }
+
+    // Appends the first n characters of the write area to the data.
+    void commit(std::size_t n) noexcept
+    {
+        LEXY_PRECONDITION(n <= write_size());
+        _size += n;
+    }
+
+    // Appends the characters to the data.
+    void append(const char* data, std::size_t size)
+    {
+        while (size > 0)
+        {
+            auto memory = write_data();
+            auto n      = size < write_size() ? size : write_size();
+            std::memcpy(memory, data, n);
+            commit(n);
+
+            data += n;
+            size -= n;
+        }
+    }
+
+    //=== chunk ===//
+    // The current chunk is [data(), data() + chunk_size()).
+    std::size_t chunk_size() const noexcept
+    {
+        return _end;
+    }
+
+    // Discards the current chunk, moving the remaining data to the front.
+    void discard_chunk() noexcept
+    {
+        if (_end == 0)
+            return;
+
+        _size -= _end;
+        _searched -= _end;
+        std::memmove(_data, _data + _end, _size);
+        _end = 0;
+    }
+
+    // Ends the current chunk after the last delimiter of the data, if there is one.
+    // The current chunk must have been discarded.
+    bool find_chunk(char delimiter) noexcept
+    {
+        LEXY_PRECONDITION(_end == 0);
+
+        // We've already searched [0, _searched) and didn't find a delimiter there.
+        for (auto idx = _size; idx != _searched; --idx)
+            if (_data[idx - 1] == delimiter)
+            {
+                _end      = idx;
+                _searched = _size;
+                return true;
+            }
+
+        _searched = _size;
+        return false;
+    }
+
+    // Ends the current chunk at the end of the data, which might not end with a delimiter.
+    // Returns false if there is no data.
+    bool finish_chunk() noexcept
+    {
+        LEXY_PRECONDITION(_end == 0);
+        _end      = _size;
+        _searched = _size;
+        return _end != 0;
+    }
+
+private:
+    void _grow()
+    {
+        auto capacity = _capacity == 0 ? std::size_t(1024) : 2 * _capacity;
+        auto memory   = new char[capacity];
+        if (_size > 0)
+            std::memcpy(memory, _data, _size);
+        delete[] _data;
+
+        _data     = memory;
+        _capacity = capacity;
+    }
+
+    char*       _data;
+    std::size_t _capacity, _size, _end, _searched;
+};
+} // namespace lexy::_detail
+
+#endif // LEXY_DETAIL_CHUNK_BUFFER_HPP_INCLUDED
+
@@ -76,6 +76,18 @@ using type_or = std::conditional_t<std::is_void_v<T>, Fallback, T>;
 #    define LEXY_CONSTEVAL constexpr
 #endif
 
+//=== __builtin_bit_cast ===//
+#ifndef LEXY_HAS_BUILTIN_BIT_CAST
+#    if defined(__has_builtin)
+#        if __has_builtin(__builtin_bit_cast)
+#            define LEXY_HAS_BUILTIN_BIT_CAST 1
+#        endif
+#    endif
+#    ifndef LEXY_HAS_BUILTIN_BIT_CAST
+#        define LEXY_HAS_BUILTIN_BIT_CAST 0
+#    endif
+#endif
+
 //=== char8_t ===//
 #ifndef LEXY_HAS_CHAR8_T
 #    if __cpp_char8_t
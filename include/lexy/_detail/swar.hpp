@@ -0,0 +1,132 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef LEXY_DETAIL_SWAR_HPP_INCLUDED
+#define LEXY_DETAIL_SWAR_HPP_INCLUDED
+
+#include <climits>
+#include <cstdint>
+#include <lexy/_detail/config.hpp>
+#include <lexy/_detail/integer_sequence.hpp>
+
+// SIMD within a register: process multiple single-byte code units at once using integer
+// arithmetic. Unlike vector intrinsics, this is portable and works during constant evaluation.
+namespace lexy::_detail
+{
+// Contains the code units in little endian order, i.e. the first code unit is stored in the lowest
+// byte, regardless of the actual endianness of the platform.
+using swar_int = std::uint_least64_t;
+
+// The number of code units that fit into one swar_int.
+constexpr std::size_t swar_length = 8;
+
+// Returns a swar_int where every byte has the given value.
+constexpr swar_int swar_fill(unsigned char c)
+{
+    return swar_int(c) * swar_int(0x0101'0101'0101'0101);
+}
+
+template <typename CharT, std::size_t... Idx>
+constexpr swar_int _swar_load(const CharT* ptr, index_sequence<Idx...>)
+{
+    // Compilers recognize this pattern and turn it into a single load instruction.
+    return ((swar_int(static_cast<unsigned char>(ptr[Idx])) << (Idx * CHAR_BIT)) | ...);
+}
+
+// Loads the next N code units starting at ptr; the remaining bytes are zero.
+template <std::size_t N = swar_length, typename CharT>
+constexpr swar_int swar_load(const CharT* ptr)
+{
+    static_assert(sizeof(CharT) == 1 && 0 < N && N <= swar_length);
+    return _swar_load(ptr, make_index_sequence<N>{});
+}
+
+// Returns a mask that has the high bit set in every byte of x that is zero.
+// Only the lowest set bit is guaranteed to be exact; bytes after it might be false positives.
+constexpr swar_int swar_zero_mask(swar_int x)
+{
+    return (x - swar_fill(0x01)) & ~x & swar_fill(0x80);
+}
+
+// Returns a mask that has the high bit set in every byte of x that is equal to c.
+// Same caveat as for swar_zero_mask() applies.
+constexpr swar_int swar_char_mask(swar_int x, unsigned char c)
+{
+    return swar_zero_mask(x ^ swar_fill(c));
+}
+
+// Returns a mask that has the high bit set in every byte of x that is equal to c.
+// Unlike swar_char_mask(), the mask is exact for every byte.
+constexpr swar_int swar_equal_mask(swar_int x, unsigned char c)
+{
+    auto zero = x ^ swar_fill(c);
+    // The high bit of every non-zero byte is set, without any carries between bytes.
+    auto nonzero = ((zero & swar_fill(0x7F)) + swar_fill(0x7F)) | zero;
+    return ~nonzero & swar_fill(0x80);
+}
+
+// Returns a mask that has the high bit set in every byte of x that is in the range [min, max].
+// Both min and max must be ASCII; bytes with the high bit set are never in the range.
+// Unlike the masks above, the result is exact for every byte.
+constexpr swar_int swar_range_mask(swar_int x, unsigned char min, unsigned char max)
+{
+    // Clearing the high bit ensures that the additions below never carry into the next byte.
+    auto low = x & swar_fill(0x7F);
+    // The high bit of a byte is set if it is >= min, or > max, respectively.
+    auto ge_min = low + swar_fill(static_cast<unsigned char>(0x80 - min));
+    auto gt_max = low + swar_fill(static_cast<unsigned char>(0x7F - max));
+    return ge_min & ~gt_max & ~x & swar_fill(0x80);
+}
+
+// Returns the value of the swar_length digits in x, the first digit being the most significant.
+// Every code unit must be an ASCII digit of the radix, where letters can be in either case.
+template <unsigned Radix>
+constexpr std::uint_least32_t swar_parse_digits(swar_int x)
+{
+    static_assert(Radix == 10 || Radix == 16);
+
+    // The value of every digit is in the lower nibble, letters additionally have bit 6 set.
+    x = (x & swar_fill(0x0F)) + ((x >> 6) & swar_fill(0x01)) * 9;
+
+    if constexpr (Radix == 10)
+    {
+        // Combine adjacent digits into pairs, then groups of four, then the final value.
+        x = x * 10 + (x >> 8);
+        x = ((x & 0x0000'00FF'0000'00FF) * (100 + (1000000ull << 32))
+             + ((x >> 16) & 0x0000'00FF'0000'00FF) * (1 + (10000ull << 32)))
+            >> 32;
+        return std::uint_least32_t(x);
+    }
+    else
+    {
+        // Same as above, but we can use shifts instead of multiplications.
+        x = ((x << 4) | (x >> 8)) & 0x00FF'00FF'00FF'00FF;
+        x = ((x << 8) | (x >> 16)) & 0x0000'FFFF'0000'FFFF;
+        x = ((x << 16) | (x >> 32)) & 0xFFFF'FFFF;
+        return std::uint_least32_t(x);
+    }
+}
+
+// Returns the number of trailing zero bits in x, which must not be zero.
+constexpr std::size_t countr_zero(swar_int x)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return std::size_t(__builtin_ctzll(x));
+#else
+    auto result = std::size_t(0);
+    for (; (x & 1) == 0; x >>= 1)
+        ++result;
+    return result;
+#endif
+}
+
+// Returns the index of the first code unit whose high bit is set in the mask, which must not be
+// zero.
+constexpr std::size_t swar_find_first(swar_int mask)
+{
+    return countr_zero(mask) / CHAR_BIT;
+}
+} // namespace lexy::_detail
+
+#endif // LEXY_DETAIL_SWAR_HPP_INCLUDED
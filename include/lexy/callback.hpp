@@ -12,6 +12,7 @@
 #include <lexy/callback/composition.hpp>
 #include <lexy/callback/constant.hpp>
 #include <lexy/callback/container.hpp>
+#include <lexy/callback/floating_point.hpp>
 #include <lexy/callback/fold.hpp>
 #include <lexy/callback/forward.hpp>
 #include <lexy/callback/integer.hpp>
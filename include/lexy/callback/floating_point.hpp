@@ -0,0 +1,45 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef LEXY_CALLBACK_FLOATING_POINT_HPP_INCLUDED
+#define LEXY_CALLBACK_FLOATING_POINT_HPP_INCLUDED
+
+#include <lexy/callback/base.hpp>
+#include <lexy/dsl/sign.hpp>
+
+namespace lexy
+{
+template <typename T>
+struct _float
+{
+    using return_type = T;
+
+    // You don't actually produce a floating-point value.
+    constexpr T operator()(lexy::plus_sign) const  = delete;
+    constexpr T operator()(lexy::minus_sign) const = delete;
+
+    template <typename Float>
+    constexpr T operator()(const Float& value) const
+    {
+        return T(value);
+    }
+    template <typename Float>
+    constexpr T operator()(lexy::plus_sign, const Float& value) const
+    {
+        return T(value);
+    }
+    template <typename Float>
+    constexpr T operator()(lexy::minus_sign, const Float& value) const
+    {
+        return T(-value);
+    }
+};
+
+// A callback that takes an optional sign and a floating-point number and produces the signed
+// number.
+template <typename T>
+constexpr auto as_floating_point = _float<T>{};
+} // namespace lexy
+
+#endif // LEXY_CALLBACK_FLOATING_POINT_HPP_INCLUDED
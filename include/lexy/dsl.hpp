@@ -23,6 +23,7 @@
 #include <lexy/dsl/encode.hpp>
 #include <lexy/dsl/eof.hpp>
 #include <lexy/dsl/error.hpp>
+#include <lexy/dsl/floating_point.hpp>
 #include <lexy/dsl/identifier.hpp>
 #include <lexy/dsl/if.hpp>
 #include <lexy/dsl/integer.hpp>
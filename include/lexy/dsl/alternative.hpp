@@ -42,6 +42,26 @@ struct _alt_trie
     static constexpr auto trie = lexy::trie<_char_type, typename Tokens::string...>;
 };
 
+template <typename... Strings>
+constexpr bool _alt_unique_strings = true;
+template <typename H, typename... T>
+constexpr bool _alt_unique_strings<H, T...> = (!std::is_same_v<H, T> && ...)
+                                              && _alt_unique_strings<T...>;
+
+// Whether the tokens can be put into one _alt_trie without changing the meaning of their order.
+// Identical strings have the same type, but only if they have the same character type.
+template <typename... Tokens>
+constexpr bool _alt_can_share_trie = [] {
+    if constexpr (sizeof...(Tokens) == 0)
+        return true;
+    else
+    {
+        using char_type = std::common_type_t<typename Tokens::string::char_type...>;
+        return (std::is_same_v<typename Tokens::string::char_type, char_type> && ...)
+               && _alt_unique_strings<typename Tokens::string...>;
+    }
+}();
+
 template <typename Trie, typename Manual, typename... Tokens>
 struct _alt_engine;
 template <typename... Lits, typename... Tokens>
@@ -94,6 +114,32 @@ struct _alt_engine<_alt_impl<Lits...>, _alt_impl<Tokens...>>
             reader = LEXY_MOV(longest_reader);
             return error_code();
         }
+
+        // If all tokens are literals, we can search for them using the trie.
+        template <typename Encoding>
+        static LEXY_CONSTEVAL bool _can_find()
+        {
+            if constexpr (sizeof...(Lits) > 0 && sizeof...(Tokens) == 0)
+                return lexy::engine_trie<_alt_trie<Lits...>::trie>::template _can_find<Encoding>();
+            else
+                return false;
+        }
+
+        template <typename Encoding, typename CharT>
+        static constexpr const CharT* _find(const CharT* cur, const CharT* end)
+        {
+            return lexy::engine_trie<_alt_trie<Lits...>::trie>::template _find<Encoding>(cur, end);
+        }
+
+        static LEXY_CONSTEVAL auto first_bytes()
+        {
+            lexy::_detail::byte_set result;
+            if constexpr (sizeof...(Lits) > 0)
+                result.insert(
+                    lexy::engine_first_bytes<lexy::engine_trie<_alt_trie<Lits...>::trie>>);
+            (result.insert(lexy::engine_first_bytes<typename Tokens::token_engine>), ...);
+            return result;
+        }
     };
 };
 template <typename... Lits, typename... Tokens, typename H, typename... T>
@@ -5,7 +5,11 @@
 #ifndef LEXY_DSL_CHOICE_HPP_INCLUDED
 #define LEXY_DSL_CHOICE_HPP_INCLUDED
 
+#include <climits>
+#include <cstdint>
+#include <lexy/dsl/alternative.hpp>
 #include <lexy/dsl/base.hpp>
+#include <lexy/dsl/branch.hpp>
 #include <lexy/error.hpp>
 
 namespace lexy
@@ -21,20 +25,141 @@ struct exhausted_choice
 
 namespace lexyd
 {
+template <typename... R>
+struct _chc;
+
+// The code units a branch can start with, if it is taken.
+// If we don't know them, any code unit is possible.
+template <typename Rule>
+LEXY_CONSTEVAL auto _chc_first_bytes(Rule)
+{
+    if constexpr (lexy::is_token_rule<Rule>)
+        return lexy::engine_first_bytes<typename Rule::token_engine>;
+    else
+        return lexy::_detail::byte_set::all();
+}
+template <typename Condition, typename... R>
+LEXY_CONSTEVAL auto _chc_first_bytes(_br<Condition, R...>)
+{
+    return _chc_first_bytes(Condition{});
+}
+template <typename... R>
+LEXY_CONSTEVAL auto _chc_first_bytes(_chc<R...>)
+{
+    lexy::_detail::byte_set result;
+    (result.insert(_chc_first_bytes(R{})), ...);
+    return result;
+}
+
+template <typename Token>
+using _detect_string_char_type = typename Token::string::char_type;
+
+// The literal token a branch starts with, or void if it doesn't start with one.
+template <typename Rule>
+auto _chc_literal(Rule)
+{
+    if constexpr (lexy::is_token_rule<Rule>
+                  && lexy::_detail::is_detected<_detect_string_char_type, Rule>)
+        return Rule{};
+}
+template <typename Condition, typename... R>
+auto _chc_literal(_br<Condition, R...>)
+{
+    return _chc_literal(Condition{});
+}
+
+// Collects the literals of all branches that start with one.
+template <typename Literals, typename... R>
+struct _chc_literals
+{
+    using type = Literals;
+};
+template <typename... Literals, typename H, typename... T>
+struct _chc_literals<_alt_impl<Literals...>, H, T...>
+{
+    using _literal = decltype(_chc_literal(H{}));
+    using _next    = std::conditional_t<std::is_void_v<_literal>, _alt_impl<Literals...>,
+                                     _alt_impl<Literals..., _literal>>;
+    using type     = typename _chc_literals<_next, T...>::type;
+};
+
+// Finds the first of the literals that matches using a trie.
+template <typename Literals>
+struct _chc_literal_trie;
+template <typename... Literals>
+struct _chc_literal_trie<_alt_impl<Literals...>>
+{
+    static constexpr auto npos = std::size_t(-1);
+
+    template <typename... Lits>
+    using _engine = lexy::engine_trie<_alt_trie<Lits...>::trie>;
+
+    template <typename Encoding>
+    static LEXY_CONSTEVAL bool can_match()
+    {
+        // With fewer literals, the first code unit is enough to find it.
+        if constexpr (sizeof...(Literals) < 2 || !_alt_can_share_trie<Literals...>)
+            return false;
+        else
+            return _engine<Literals...>::template _can_find<Encoding>();
+    }
+
+    // Returns the index of the first literal that matches at cur, or npos.
+    template <typename Encoding, typename CharT>
+    static constexpr std::size_t match(const CharT* cur, const CharT* end)
+    {
+        constexpr auto& table = _engine<Literals...>::template _table<Encoding>;
+
+        // The trie values are the indices of the literals.
+        // As multiple literals can match, we need the smallest one on the path.
+        auto result = npos;
+        auto node   = std::size_t(0);
+        for (; cur != end; ++cur)
+        {
+            node = table.template next<Encoding>(node, Encoding::to_int_type(*cur));
+            if (node == table.invalid_node)
+                break;
+            else if (table._node_value[node] < result)
+                result = table._node_value[node];
+        }
+        return result;
+    }
+};
+
+// A bit mask of the branches of a choice that are viable, bit zero is the first branch.
+// If there are more branches than bits, the highest bit stands for all remaining branches.
+template <std::size_t BranchCount>
+using _chc_mask = std::conditional_t<
+    BranchCount <= 8, std::uint_least8_t,
+    std::conditional_t<BranchCount <= 16, std::uint_least16_t,
+                       std::conditional_t<BranchCount <= 32, std::uint_least32_t,
+                                          std::uint_least64_t>>>;
+
+template <typename Mask>
+constexpr Mask _chc_mask_all = Mask(-1);
+
+// The mask of the remaining branches after the first one.
+template <typename Mask>
+constexpr Mask _chc_mask_next(Mask viable)
+{
+    constexpr auto high_bit = Mask(Mask(1) << (sizeof(Mask) * CHAR_BIT - 1));
+    return Mask((viable >> 1) | (viable & high_bit));
+}
+
 template <typename NextParser, typename... R>
 struct _chc_parser;
 template <typename NextParser>
 struct _chc_parser<NextParser>
 {
-    template <typename Context, typename Reader, typename... Args>
-    LEXY_DSL_FUNC auto try_parse(Context&, Reader&, Args&&...) -> lexy::rule_try_parse_result
+    template <typename Mask, typename Context, typename Reader, typename... Args>
+    LEXY_DSL_FUNC auto try_parse(Mask, Context&, Reader&, Args&&...) -> lexy::rule_try_parse_result
     {
         // We couldn't match any alternative of the choice, so as a branch we backtrack.
         return lexy::rule_try_parse_result::backtracked;
     }
 
-    template <typename Context, typename Reader, typename... Args>
-    LEXY_DSL_FUNC bool parse(Context& context, Reader& reader, Args&&...)
+    template <typename Mask, typename Context, typename Reader, typename... Args>
+    LEXY_DSL_FUNC bool parse(Mask, Context& context, Reader& reader, Args&&...)
     {
         auto err = lexy::make_error<Reader, lexy::exhausted_choice>(reader.cur());
         context.on(_ev::error{}, err);
@@ -44,8 +169,8 @@ struct _chc_parser<NextParser>
 template <typename NextParser, typename H, typename... T>
 struct _chc_parser<NextParser, H, T...>
 {
-    template <typename Context, typename Reader, typename... Args>
-    LEXY_DSL_FUNC auto try_parse(Context& context, Reader& reader, Args&&... args)
+    template <typename Mask, typename Context, typename Reader, typename... Args>
+    LEXY_DSL_FUNC auto try_parse(Mask viable, Context& context, Reader& reader, Args&&... args)
         -> lexy::rule_try_parse_result
     {
         if constexpr (H::is_unconditional_branch)
@@ -58,20 +183,30 @@ struct _chc_parser<NextParser, H, T...>
         }
         else
         {
-            // Try to parse H.
-            auto result
-                = lexy::rule_parser<H, NextParser>::try_parse(context, reader, LEXY_FWD(args)...);
+            if constexpr (!(T::is_unconditional_branch || ...))
+            {
+                if (viable == 0)
+                    // None of the remaining branches can match.
+                    return _chc_parser<NextParser>::try_parse(viable, context, reader);
+            }
+
+            // Try to parse H, unless we know that it can't match.
+            auto result = lexy::rule_try_parse_result::backtracked;
+            if (viable & 1)
+                result = lexy::rule_parser<H, NextParser>::try_parse(context, reader,
+                                                                     LEXY_FWD(args)...);
             if (result == lexy::rule_try_parse_result::backtracked)
                 // Try the next branch of the choice instead.
-                return _chc_parser<NextParser, T...>::try_parse(context, reader, LEXY_FWD(args)...);
+                return _chc_parser<NextParser, T...>::try_parse(_chc_mask_next(viable), context,
+                                                                reader, LEXY_FWD(args)...);
             else
                 // We've taken H, return its result.
                 return result;
         }
     }
 
-    template <typename Context, typename Reader, typename... Args>
-    LEXY_DSL_FUNC bool parse(Context& context, Reader& reader, Args&&... args)
+    template <typename Mask, typename Context, typename Reader, typename... Args>
+    LEXY_DSL_FUNC bool parse(Mask viable, Context& context, Reader& reader, Args&&... args)
     {
         if constexpr (H::is_unconditional_branch)
         {
@@ -80,12 +215,22 @@ struct _chc_parser<NextParser, H, T...>
         }
         else
         {
-            // Try to parse H.
-            auto result
-                = lexy::rule_parser<H, NextParser>::try_parse(context, reader, LEXY_FWD(args)...);
+            if constexpr (!(T::is_unconditional_branch || ...))
+            {
+                if (viable == 0)
+                    // None of the remaining branches can match.
+                    return _chc_parser<NextParser>::parse(viable, context, reader);
+            }
+
+            // Try to parse H, unless we know that it can't match.
+            auto result = lexy::rule_try_parse_result::backtracked;
+            if (viable & 1)
+                result = lexy::rule_parser<H, NextParser>::try_parse(context, reader,
+                                                                     LEXY_FWD(args)...);
             if (result == lexy::rule_try_parse_result::backtracked)
                 // Try the next branch of the choice instead.
-                return _chc_parser<NextParser, T...>::parse(context, reader, LEXY_FWD(args)...);
+                return _chc_parser<NextParser, T...>::parse(_chc_mask_next(viable), context,
+                                                            reader, LEXY_FWD(args)...);
             else
                 // We've taken H, return its translated result.
                 return static_cast<bool>(result);
@@ -103,8 +248,116 @@ struct _chc : rule_base
     static constexpr auto is_branch              = !_would_be_unconditional_branch;
     static constexpr auto is_unconditonal_branch = false;
 
+    using _mask = _chc_mask<sizeof...(R)>;
+
+    // We can only dispatch if we know the first code units of at least one branch.
+    static constexpr auto _can_dispatch = (!_chc_first_bytes(R{}).is_all() || ...);
+
+    // For every code unit, the branches that can start with it.
+    static LEXY_CONSTEVAL auto _make_dispatch_table()
+    {
+        struct table_t
+        {
+            _mask viable[256];
+        } result{};
+
+        constexpr lexy::_detail::byte_set first_bytes[] = {_chc_first_bytes(R{})...};
+        for (auto idx = 0u; idx != sizeof...(R); ++idx)
+        {
+            auto bit = idx < sizeof(_mask) * CHAR_BIT ? idx : sizeof(_mask) * CHAR_BIT - 1;
+            for (auto c = 0u; c != 256u; ++c)
+                if (first_bytes[idx].contains(static_cast<unsigned char>(c)))
+                    result.viable[c] |= _mask(_mask(1) << bit);
+        }
+
+        return result;
+    }
+    static constexpr auto _dispatch_table = _make_dispatch_table();
+
+    // Branches that start with a literal are selected using a trie:
+    // only the first one whose literal matches remains viable.
+    using _literals = _chc_literal_trie<typename _chc_literals<_alt_impl<>, R...>::type>;
+
+    template <typename Encoding>
+    static LEXY_CONSTEVAL bool _can_match_literals()
+    {
+        // We need one bit for every branch.
+        return sizeof...(R) <= sizeof(_mask) * CHAR_BIT
+               && _literals::template can_match<Encoding>();
+    }
+
+    static LEXY_CONSTEVAL auto _make_literal_bits()
+    {
+        struct bits_t
+        {
+            // The bit of the branch of each literal.
+            _mask literal[sizeof...(R)];
+            // The bits of all branches that start with a literal.
+            _mask all;
+        } result{};
+
+        constexpr bool is_literal[] = {!std::is_void_v<decltype(_chc_literal(R{}))>...};
+        auto           literal_idx  = 0u;
+        for (auto idx = 0u; idx != sizeof...(R); ++idx)
+            if (is_literal[idx])
+            {
+                auto bit                      = _mask(_mask(1) << idx);
+                result.literal[literal_idx++] = bit;
+                result.all |= bit;
+            }
+
+        return result;
+    }
+    static constexpr auto _literal_bits = _make_literal_bits();
+
+    template <typename Reader>
+    static constexpr _mask _viable(const Reader& reader)
+    {
+        using encoding = typename Reader::encoding;
+        if constexpr (_can_dispatch && lexy::_is_contiguous_byte_reader<Reader>)
+        {
+            if (reader.eof())
+                return _chc_mask_all<_mask>;
+
+            auto result = _dispatch_table.viable[static_cast<unsigned char>(*reader.cur())];
+            if constexpr (_can_match_literals<encoding>())
+            {
+                if (result & _literal_bits.all)
+                {
+                    result = _mask(result & ~_literal_bits.all);
+                    auto literal
+                        = _literals::template match<encoding>(reader.cur(), reader._end_pos());
+                    if (literal != _literals::npos)
+                        result = _mask(result | _literal_bits.literal[literal]);
+                }
+            }
+            return result;
+        }
+        else
+        {
+            return _chc_mask_all<_mask>;
+        }
+    }
+
     template <typename NextParser>
-    using parser = _chc_parser<NextParser, R...>;
+    struct parser
+    {
+        template <typename Context, typename Reader, typename... Args>
+        LEXY_DSL_FUNC auto try_parse(Context& context, Reader& reader, Args&&... args)
+            -> lexy::rule_try_parse_result
+        {
+            // Only try the branches that can start with the current code unit.
+            return _chc_parser<NextParser, R...>::try_parse(_viable(reader), context, reader,
+                                                             LEXY_FWD(args)...);
+        }
+
+        template <typename Context, typename Reader, typename... Args>
+        LEXY_DSL_FUNC bool parse(Context& context, Reader& reader, Args&&... args)
+        {
+            return _chc_parser<NextParser, R...>::parse(_viable(reader), context, reader,
+                                                         LEXY_FWD(args)...);
+        }
+    };
 };
 
 template <typename R, typename S>
@@ -54,6 +54,18 @@ struct _cp : token_base<_cp<Predicate>>
 
             return error_code();
         }
+
+        template <typename Encoding>
+        static LEXY_CONSTEVAL auto _single_bytes()
+        {
+            // Every ASCII character is a code point on its own.
+            lexy::_detail::byte_set result;
+            if constexpr (std::is_void_v<Predicate>
+                          && (std::is_same_v<Encoding, lexy::ascii_encoding>
+                              || std::is_same_v<Encoding, lexy::utf8_encoding>))
+                result.insert(0x00, 0x7F);
+            return result;
+        }
     };
 
     template <typename Context, typename Reader>
@@ -81,6 +81,18 @@ struct _comb_it : rule_base
     };
 };
 
+// The choice of the combination dispatches on the first code units or literals of the items.
+template <std::size_t Idx, typename Rule>
+LEXY_CONSTEVAL auto _chc_first_bytes(_comb_it<Idx, Rule>)
+{
+    return _chc_first_bytes(Rule{});
+}
+template <std::size_t Idx, typename Rule>
+auto _chc_literal(_comb_it<Idx, Rule>)
+{
+    return _chc_literal(Rule{});
+}
+
 template <typename DuplicateError, typename ElseRule, typename... R>
 struct _comb : rule_base
 {
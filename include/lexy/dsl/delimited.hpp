@@ -69,12 +69,69 @@ constexpr auto _del_parse_char(Context& context, Reader& reader, Sink& sink)
     return true;
 }
 
+template <typename Escape, typename... Branches>
+struct _escape;
+
+template <typename Rule>
+LEXY_CONSTEVAL auto _del_first_bytes(Rule)
+{
+    return _chc_first_bytes(Rule{});
+}
+template <typename Escape, typename... Branches>
+LEXY_CONSTEVAL auto _del_first_bytes(_escape<Escape, Branches...>)
+{
+    return _chc_first_bytes(Escape{});
+}
+
 template <typename Close, typename Char, typename Limit, typename... Escapes>
 struct _del : rule_base
 {
+    // The code units that can be part of a run of plain characters:
+    // they are matched by Char on their own and don't start anything else.
+    template <typename Encoding>
+    static LEXY_CONSTEVAL auto _make_run_bytes()
+    {
+        lexy::_detail::byte_set stop;
+        stop.insert(_del_first_bytes(Close{}));
+        stop.insert(_del_first_bytes(Limit{}));
+        (stop.insert(_del_first_bytes(Escapes{})), ...);
+
+        constexpr auto chars = lexy::_engine_single_bytes<typename Char::token_engine, Encoding>;
+
+        lexy::_detail::byte_set result;
+        for (auto c = 0u; c != 256u; ++c)
+            if (chars.contains(static_cast<unsigned char>(c))
+                && !stop.contains(static_cast<unsigned char>(c)))
+                result.insert(static_cast<unsigned char>(c));
+        return result;
+    }
+
+    template <typename Encoding>
+    static constexpr auto _run_bytes = _make_run_bytes<Encoding>();
+
     template <typename NextParser>
     struct parser
     {
+        template <typename Context, typename Reader, typename Sink>
+        LEXY_DSL_FUNC void _parse_run(Context& context, Reader& reader, Sink& sink)
+        {
+            using encoding = typename Reader::encoding;
+            if constexpr (lexy::_is_contiguous_byte_reader<Reader>
+                          && _run_bytes<encoding>.size() != 0)
+            {
+                auto begin = reader.cur();
+                lexy::engine_skip_while<_run_bytes<encoding>>(reader);
+                auto end = reader.cur();
+
+                // The entire run is reported as a single token.
+                if (begin != end)
+                {
+                    context.on(_ev::token{}, Char::token_kind(), begin, end);
+                    sink(lexy::lexeme<Reader>(begin, end));
+                }
+            }
+        }
+
         template <typename Context, typename Reader, typename... Args>
         LEXY_DSL_FUNC bool parse(Context& context, Reader& reader, Args&&... args)
         {
@@ -84,6 +141,9 @@ struct _del : rule_base
             using close = lexy::rule_parser<Close, _list_finish<NextParser, Args...>>;
             while (true)
             {
+                // Skip characters that can't be anything but Char.
+                _parse_run(context, reader, sink);
+
                 // Try to finish parsing the production.
                 if (auto result = close::try_parse(context, reader, LEXY_FWD(args)..., sink);
                     result != lexy::rule_try_parse_result::backtracked)
@@ -6,6 +6,7 @@
 #define LEXY_DSL_DIGIT_HPP_INCLUDED
 
 #include <lexy/_detail/ascii_table.hpp>
+#include <lexy/_detail/swar.hpp>
 #include <lexy/dsl/base.hpp>
 #include <lexy/dsl/literal.hpp>
 #include <lexy/dsl/token.hpp>
@@ -68,6 +69,13 @@ struct decimal
     {
         return static_cast<unsigned>(c) - '0';
     }
+
+    // The code units of the word that are digits, see lexy::_detail::swar_range_mask().
+    LEXY_DSL_FUNC lexy::_detail::swar_int swar_digit_mask(lexy::_detail::swar_int word)
+    {
+        using lexy::_detail::swar_range_mask;
+        return swar_range_mask(word, '0', '9');
+    }
 };
 
 struct hex_lower
@@ -92,6 +100,13 @@ struct hex_lower
         else
             return unsigned(-1);
     }
+
+    // The code units of the word that are digits, see lexy::_detail::swar_range_mask().
+    LEXY_DSL_FUNC lexy::_detail::swar_int swar_digit_mask(lexy::_detail::swar_int word)
+    {
+        using lexy::_detail::swar_range_mask;
+        return swar_range_mask(word, '0', '9') | swar_range_mask(word, 'a', 'f');
+    }
 };
 
 struct hex_upper
@@ -116,6 +131,13 @@ struct hex_upper
         else
             return unsigned(-1);
     }
+
+    // The code units of the word that are digits, see lexy::_detail::swar_range_mask().
+    LEXY_DSL_FUNC lexy::_detail::swar_int swar_digit_mask(lexy::_detail::swar_int word)
+    {
+        using lexy::_detail::swar_range_mask;
+        return swar_range_mask(word, '0', '9') | swar_range_mask(word, 'A', 'F');
+    }
 };
 
 struct hex
@@ -143,6 +165,14 @@ struct hex
         else
             return unsigned(-1);
     }
+
+    // The code units of the word that are digits, see lexy::_detail::swar_range_mask().
+    LEXY_DSL_FUNC lexy::_detail::swar_int swar_digit_mask(lexy::_detail::swar_int word)
+    {
+        using lexy::_detail::swar_range_mask;
+        return swar_range_mask(word, '0', '9') | swar_range_mask(word, 'a', 'f')
+               | swar_range_mask(word, 'A', 'F');
+    }
 };
 } // namespace lexyd
 
@@ -0,0 +1,172 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef LEXY_DSL_FLOATING_POINT_HPP_INCLUDED
+#define LEXY_DSL_FLOATING_POINT_HPP_INCLUDED
+
+#include <lexy/_detail/float.hpp>
+#include <lexy/dsl/base.hpp>
+#include <lexy/dsl/digit.hpp>
+#include <lexy/dsl/token.hpp>
+#include <lexy/engine/digits.hpp>
+
+namespace lexyd
+{
+// Matches digits, optionally followed by a fraction and an exponent.
+struct _float_token : token_base<_float_token>
+{
+    struct token_engine : lexy::engine_matcher_base
+    {
+        using _digits = lexy::engine_digits<decimal::digit_set>;
+
+        enum class error_code
+        {
+            missing_digits = 1,
+        };
+
+        template <typename Reader>
+        static constexpr error_code match(Reader& reader)
+        {
+            using encoding = typename Reader::encoding;
+
+            if (_digits::match(reader) != typename _digits::error_code())
+                return error_code::missing_digits;
+
+            if (reader.peek() == lexy::_char_to_int_type<encoding>('.'))
+            {
+                reader.bump();
+                if (_digits::match(reader) != typename _digits::error_code())
+                    return error_code::missing_digits;
+            }
+
+            if (auto exp_char = reader.peek();
+                exp_char == lexy::_char_to_int_type<encoding>('e')
+                || exp_char == lexy::_char_to_int_type<encoding>('E'))
+            {
+                reader.bump();
+
+                auto sign = reader.peek();
+                if (sign == lexy::_char_to_int_type<encoding>('+')
+                    || sign == lexy::_char_to_int_type<encoding>('-'))
+                    reader.bump();
+
+                if (_digits::match(reader) != typename _digits::error_code())
+                    return error_code::missing_digits;
+            }
+
+            return error_code();
+        }
+
+        static LEXY_CONSTEVAL auto first_bytes()
+        {
+            return lexy::engine_first_bytes<_digits>;
+        }
+    };
+
+    template <typename Context, typename Reader>
+    static constexpr void token_error(Context& context, const Reader&,
+                                      typename token_engine::error_code,
+                                      typename Reader::iterator pos)
+    {
+        auto err = lexy::make_error<Reader, lexy::expected_char_class>(pos, decimal::name());
+        context.on(_ev::error{}, err);
+    }
+};
+
+template <typename T>
+struct _float : rule_base
+{
+    static constexpr auto is_branch               = true;
+    static constexpr auto is_unconditional_branch = false;
+
+    // Converts the code units matched by the token.
+    // We can't rely on end, as it includes whitespace that was skipped after the token.
+    template <typename Iterator>
+    static constexpr T _value(Iterator cur, Iterator end)
+    {
+        auto is_digit = [&] { return cur != end && '0' <= *cur && *cur <= '9'; };
+
+        lexy::_detail::float_decimal<Iterator> decimal{};
+        decimal.integer_begin = cur;
+        while (is_digit())
+            ++cur;
+        decimal.integer_end = cur;
+
+        decimal.fraction_begin = decimal.fraction_end = cur;
+        if (cur != end && *cur == '.')
+        {
+            ++cur;
+            decimal.fraction_begin = cur;
+            while (is_digit())
+                ++cur;
+            decimal.fraction_end = cur;
+        }
+
+        if (cur != end && (*cur == 'e' || *cur == 'E'))
+        {
+            ++cur;
+
+            auto negative = false;
+            if (cur != end && *cur == '+')
+                ++cur;
+            else if (cur != end && *cur == '-')
+            {
+                negative = true;
+                ++cur;
+            }
+
+            // Exponents that big are either zero or infinity anyway, so we can stop counting.
+            auto exponent = 0ll;
+            for (; is_digit(); ++cur)
+                if (exponent < 1'000'000'000)
+                    exponent = exponent * 10 + lexy::_detail::_float_digit(cur);
+            decimal.exponent = negative ? -exponent : exponent;
+        }
+
+        return lexy::_detail::float_from_decimal<T>(decimal);
+    }
+
+    template <typename NextParser>
+    struct parser
+    {
+        struct _continuation
+        {
+            template <typename Context, typename Reader, typename... Args>
+            LEXY_DSL_FUNC bool parse(Context& context, Reader& reader,
+                                     typename Reader::iterator begin, Args&&... args)
+            {
+                auto value = _value(begin, reader.cur());
+                return NextParser::parse(context, reader, LEXY_FWD(args)..., value);
+            }
+        };
+
+        template <typename Context, typename Reader, typename... Args>
+        LEXY_DSL_FUNC auto try_parse(Context& context, Reader& reader, Args&&... args)
+            -> lexy::rule_try_parse_result
+        {
+            return lexy::rule_parser<_float_token, _continuation>::try_parse(context, reader,
+                                                                             reader.cur(),
+                                                                             LEXY_FWD(args)...);
+        }
+
+        template <typename Context, typename Reader, typename... Args>
+        LEXY_DSL_FUNC bool parse(Context& context, Reader& reader, Args&&... args)
+        {
+            return lexy::rule_parser<_float_token, _continuation>::parse(context, reader,
+                                                                         reader.cur(),
+                                                                         LEXY_FWD(args)...);
+        }
+    };
+};
+
+/// Parses a decimal floating-point number and converts it to `T`, rounding to nearest.
+template <typename T>
+constexpr auto floating_point = [] {
+    static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>,
+                  "only float and double are supported");
+    return _float<T>{};
+}();
+} // namespace lexyd
+
+#endif // LEXY_DSL_FLOATING_POINT_HPP_INCLUDED
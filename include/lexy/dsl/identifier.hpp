@@ -5,6 +5,7 @@
 #ifndef LEXY_DSL_IDENTIFIER_HPP_INCLUDED
 #define LEXY_DSL_IDENTIFIER_HPP_INCLUDED
 
+#include <lexy/_detail/iterator.hpp>
 #include <lexy/_detail/nttp_string.hpp>
 #include <lexy/dsl/alternative.hpp>
 #include <lexy/dsl/any.hpp>
@@ -91,6 +92,80 @@ struct _contains : token_base<_contains<R>>
 template <typename String, typename Id>
 struct _kw;
 
+// Checks whether an identifier matches one of the reserved patterns.
+template <typename Lits, typename Tokens, typename... Reserved>
+struct _reserved;
+template <typename... Lits, typename... Tokens>
+struct _reserved<_alt_impl<Lits...>, _alt_impl<Tokens...>>
+{
+    static LEXY_CONSTEVAL auto _lit_length_range()
+    {
+        struct range_t
+        {
+            std::size_t min, max;
+        };
+
+        constexpr std::size_t lengths[] = {Lits::string::size...};
+        range_t               result{lengths[0], lengths[0]};
+        for (auto length : lengths)
+        {
+            if (length < result.min)
+                result.min = length;
+            if (length > result.max)
+                result.max = length;
+        }
+        return result;
+    }
+
+    template <typename Token, typename Reader>
+    static constexpr bool _matches(const Reader& reader, typename Reader::iterator end)
+    {
+        auto id_reader = lexy::partial_reader(reader, end);
+        return lexy::engine_try_match<typename Token::token_engine>(id_reader)
+               && id_reader.cur() == end;
+    }
+
+    template <typename Reader>
+    static constexpr bool is_reserved(const Reader& reader, typename Reader::iterator end)
+    {
+        if constexpr (sizeof...(Lits) > 0)
+        {
+            // All reserved literals are checked at once with a single trie lookup.
+            // Most identifiers can already be rejected by their length.
+            constexpr auto range  = _lit_length_range();
+            auto           length = lexy::_detail::range_size(reader.cur(), end);
+            if (range.min <= length && length <= range.max)
+            {
+                auto id_reader = lexy::partial_reader(reader, end);
+                if (lexy::engine_try_match<lexy::engine_trie<_alt_trie<Lits...>::trie>>(id_reader)
+                    && id_reader.cur() == end)
+                    return true;
+            }
+        }
+
+        // Other reserved patterns need to be checked individually.
+        return (_matches<Tokens>(reader, end) || ...);
+    }
+};
+template <typename... Lits, typename... Tokens, typename H, typename... T>
+struct _reserved<_alt_impl<Lits...>, _alt_impl<Tokens...>, H, T...>
+{
+    static auto _impl()
+    {
+        // Insert H into either the trie or the manual version.
+        if constexpr (_can_use_trie<H>)
+            return _reserved<_alt_impl<Lits..., H>, _alt_impl<Tokens...>, T...>{};
+        else
+            return _reserved<_alt_impl<Lits...>, _alt_impl<Tokens..., H>, T...>{};
+    }
+
+    template <typename Reader>
+    static constexpr bool is_reserved(const Reader& reader, typename Reader::iterator end)
+    {
+        return decltype(_impl())::is_reserved(reader, end);
+    }
+};
+
 template <typename Leading, typename Trailing, typename... Reserved>
 struct _id : rule_base
 {
@@ -110,11 +185,8 @@ struct _id : rule_base
             // Check that we're not creating a reserved identifier.
             if constexpr (sizeof...(Reserved) > 0)
             {
-                using reserved = decltype((Reserved{} / ...));
-
-                auto id_reader = lexy::partial_reader(saved_reader, end);
-                if (lexy::engine_try_match<typename reserved::token_engine>(id_reader)
-                    && id_reader.cur() == end)
+                using reserved = _reserved<_alt_impl<>, _alt_impl<>, Reserved...>;
+                if (reserved::is_reserved(saved_reader, end))
                 {
                     // We found a reserved identifier.
                     auto err = lexy::make_error<Reader, lexy::reserved_identifier>(begin, end);
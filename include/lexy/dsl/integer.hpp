@@ -8,6 +8,8 @@
 #include <climits>
 
 #include <lexy/_detail/assert.hpp>
+#include <lexy/_detail/detect.hpp>
+#include <lexy/_detail/swar.hpp>
 #include <lexy/code_point.hpp>
 #include <lexy/dsl/base.hpp>
 #include <lexy/dsl/digit.hpp>
@@ -235,6 +237,9 @@ struct _unbounded_integer_parser
     }
 };
 
+template <typename Base>
+using _detect_swar_digit_mask = decltype(Base::swar_digit_mask(lexy::_detail::swar_int()));
+
 // Parses T in the Base without checking for overflow.
 template <typename T, typename Base, bool AssumeOnlyDigits>
 struct _bounded_integer_parser
@@ -245,6 +250,45 @@ struct _bounded_integer_parser
 
     static constexpr auto radix = Base::radix;
 
+    // Whether we can parse multiple digits at once from the iterator.
+    template <typename Iterator>
+    static constexpr bool _can_parse_swar = [] {
+        using char_type = std::remove_cv_t<std::remove_pointer_t<Iterator>>;
+        if constexpr (!std::is_pointer_v<Iterator> || sizeof(char_type) != 1)
+            return false;
+        else if constexpr (radix != 10 && radix != 16)
+            return false;
+        else if constexpr (!lexy::_detail::is_detected<_detect_swar_digit_mask, Base>)
+            return false;
+        else if constexpr (!std::is_integral_v<result_type>
+                           || !std::is_same_v<traits, lexy::integer_traits<result_type>>)
+            return false;
+        else
+            // A word of digits needs to fit into the digits we can parse without overflow.
+            return traits::template max_digit_count<radix> > lexy::_detail::swar_length + 1;
+    }();
+
+    // Parses the next swar_length digits, if they are all digits.
+    template <typename Iterator>
+    static constexpr bool _parse_swar(result_type& result, Iterator& cur)
+    {
+        auto word = lexy::_detail::swar_load(cur);
+        if (Base::swar_digit_mask(word) != lexy::_detail::swar_fill(0x80))
+            return false;
+
+        constexpr auto factor = [] {
+            auto result = result_type(1);
+            for (auto i = 0u; i != lexy::_detail::swar_length; ++i)
+                result = result_type(result * result_type(radix));
+            return result;
+        }();
+        auto value = lexy::_detail::swar_parse_digits<radix>(word);
+
+        result = result_type(result * factor + result_type(value));
+        cur += lexy::_detail::swar_length;
+        return true;
+    }
+
     template <typename Iterator>
     static constexpr unsigned find_digit(Iterator& cur, Iterator end)
     {
@@ -294,7 +338,17 @@ struct _bounded_integer_parser
 
         // Handle max_digit_count - 1 digits without checking for overflow.
         // We cannot overflow, as the maximal value has one digit more.
-        for (std::size_t digit_count = 1; digit_count < max_digit_count - 1; ++digit_count)
+        std::size_t digit_count = 1;
+        if constexpr (_can_parse_swar<Iterator>)
+        {
+            // Parse as many words as possible at once.
+            // If a word contains anything other than digits, we fallback to the loop below.
+            while (digit_count + lexy::_detail::swar_length < max_digit_count
+                   && static_cast<std::size_t>(end - cur) >= lexy::_detail::swar_length
+                   && _parse_swar(result, cur))
+                digit_count += lexy::_detail::swar_length;
+        }
+        for (; digit_count < max_digit_count - 1; ++digit_count)
         {
             auto digit = find_digit(cur, end);
             if (digit == unsigned(-1))
@@ -323,6 +377,56 @@ using _integer_parser
     = std::conditional_t<_is_bounded<T>, _bounded_integer_parser<T, Base, AssumeOnlyDigits>,
                          _unbounded_integer_parser<T, Base>>;
 
+// Matches and parses a fixed number of digits at once, e.g. the digits of `\uXXXX`.
+template <typename Rule, typename IntParser>
+struct _int_fixed
+{
+    template <typename Reader>
+    static constexpr bool can_parse = false;
+};
+template <std::size_t N, typename Base, typename IntParser>
+struct _int_fixed<_ndigits<N, Base>, IntParser>
+{
+    using result_type = typename IntParser::result_type;
+
+    template <typename Reader>
+    static constexpr bool can_parse = [] {
+        if constexpr (!lexy::_is_contiguous_byte_reader<Reader> || N > lexy::_detail::swar_length)
+            return false;
+        else if constexpr (Base::radix != 10 && Base::radix != 16)
+            return false;
+        else if constexpr (!lexy::_detail::is_detected<_detect_swar_digit_mask, Base>)
+            return false;
+        else if constexpr (!std::is_integral_v<result_type>
+                           && !std::is_same_v<result_type, lexy::code_point>)
+            return false;
+        else
+            // The integer is unbounded if N digits can't overflow, so we don't need to check.
+            return !IntParser::traits::is_bounded;
+    }();
+
+    template <typename Reader>
+    static constexpr bool parse(result_type& result, Reader& reader)
+    {
+        // If the reader is padded, we can always load N code units: the padding is never a digit.
+        auto cur = reader.cur();
+        if (lexy::_reader_padding<Reader> < N
+            && static_cast<std::size_t>(reader._end_pos() - cur) < N)
+            return false;
+
+        // The digits are in the lower N code units of the word.
+        constexpr auto unused = (lexy::_detail::swar_length - N) * CHAR_BIT;
+        auto           word   = lexy::_detail::swar_load<N>(cur);
+        if (Base::swar_digit_mask(word) != lexy::_detail::swar_fill(0x80) >> unused)
+            return false;
+
+        // Move them to the top, so the unused code units become leading zeroes.
+        result = result_type(lexy::_detail::swar_parse_digits<Base::radix>(word << unused));
+        reader._seek(cur + N);
+        return true;
+    }
+};
+
 template <typename Rule, typename Sep, typename IntParser, typename Tag>
 struct _int : rule_base
 {
@@ -357,6 +461,21 @@ struct _int : rule_base
         LEXY_DSL_FUNC auto try_parse(Context& context, Reader& reader, Args&&... args)
             -> lexy::rule_try_parse_result
         {
+            if constexpr (_int_fixed<Rule, IntParser>::template can_parse<Reader>)
+            {
+                auto begin  = reader.cur();
+                auto result = typename IntParser::result_type(0);
+                if (_int_fixed<Rule, IntParser>::parse(result, reader))
+                {
+                    context.on(_ev::token{}, Rule::token_kind(), begin, reader.cur());
+
+                    using continuation = lexy::whitespace_parser<Context, NextParser>;
+                    return static_cast<lexy::rule_try_parse_result>(
+                        continuation::parse(context, reader, LEXY_FWD(args)..., result));
+                }
+                // Let the token backtrack otherwise.
+            }
+
             auto failed = true; // doesn't matter
             return lexy::rule_parser<Rule, _continuation>::try_parse(context, reader, failed,
                                                                      reader.cur(),
@@ -366,6 +485,20 @@ struct _int : rule_base
         template <typename Context, typename Reader, typename... Args>
         LEXY_DSL_FUNC bool parse(Context& context, Reader& reader, Args&&... args)
         {
+            if constexpr (_int_fixed<Rule, IntParser>::template can_parse<Reader>)
+            {
+                auto begin  = reader.cur();
+                auto result = typename IntParser::result_type(0);
+                if (_int_fixed<Rule, IntParser>::parse(result, reader))
+                {
+                    context.on(_ev::token{}, Rule::token_kind(), begin, reader.cur());
+
+                    using continuation = lexy::whitespace_parser<Context, NextParser>;
+                    return continuation::parse(context, reader, LEXY_FWD(args)..., result);
+                }
+                // Let the token report the error otherwise.
+            }
+
             auto failed = true;
             auto begin  = reader.cur();
 
@@ -8,6 +8,7 @@
 #include <lexy/_detail/nttp_string.hpp>
 #include <lexy/_detail/string_view.hpp>
 #include <lexy/dsl/base.hpp>
+#include <lexy/dsl/sequence.hpp>
 #include <lexy/dsl/token.hpp>
 #include <lexy/engine/literal.hpp>
 
@@ -36,6 +37,41 @@ struct _lit : token_base<_lit<String>>
     }
 };
 
+// Adjacent literals are compared as one literal.
+template <typename Lhs, typename Rhs>
+struct _seq_fuse<_lit<Lhs>, _lit<Rhs>,
+                 std::enable_if_t<std::is_same_v<typename Lhs::char_type, typename Rhs::char_type>>>
+{
+    static constexpr auto _trie = lexy::concat_linear_trie<_lit<Lhs>::_trie, _lit<Rhs>::_trie>;
+    using _engine               = lexy::engine_literal<_trie>;
+
+    template <typename Reader>
+    static LEXY_CONSTEVAL bool can_fuse()
+    {
+        return lexy::_is_contiguous_byte_reader<Reader>
+               && _engine::template _is_bytes<typename Reader::encoding>();
+    }
+
+    template <typename Context, typename Reader>
+    static constexpr bool match(Context& context, Reader& reader)
+    {
+        using encoding = typename Reader::encoding;
+
+        auto begin = reader.cur();
+        if (static_cast<std::size_t>(reader._end_pos() - begin) < _trie.size()
+            || !_engine::template _matches_at<encoding>(begin))
+            return false;
+
+        auto middle = begin + _lit<Lhs>::_trie.size();
+        auto end    = begin + _trie.size();
+        reader._seek(end);
+
+        context.on(_ev::token{}, _lit<Lhs>::token_kind(), begin, middle);
+        context.on(_ev::token{}, _lit<Rhs>::token_kind(), middle, end);
+        return true;
+    }
+};
+
 template <auto C>
 constexpr auto lit_c = _lit<lexy::_detail::type_char<C>>{};
 
@@ -9,8 +9,47 @@
 
 namespace lexyd
 {
+// Two adjacent tokens that can be matched in one go.
+// Specialized by the tokens that support it; `match()` has to produce the same events.
+template <typename H, typename N, typename = void>
+struct _seq_fuse
+{
+    template <typename Reader>
+    static LEXY_CONSTEVAL bool can_fuse()
+    {
+        return false;
+    }
+};
+
+// Fusing is only possible if there is no whitespace to skip in between.
+template <typename Context, typename Reader, typename... R>
+constexpr bool _seq_can_fuse = false;
+template <typename Context, typename Reader, typename H, typename N, typename... T>
+constexpr bool _seq_can_fuse<Context, Reader, H, N, T...> //
+    = std::is_void_v<lexy::production_whitespace<typename Context::production,
+                                                 typename Context::root_production>> //
+      && _seq_fuse<H, N>::template can_fuse<Reader>();
+
 template <typename... R>
 struct _seq_impl;
+
+template <typename NextParser, typename H, typename N, typename... T>
+struct _seq_fused_parser
+{
+    template <typename Context, typename Reader, typename... Args>
+    LEXY_DSL_FUNC bool parse(Context& context, Reader& reader, Args&&... args)
+    {
+        if (_seq_fuse<H, N>::match(context, reader))
+        {
+            using continuation = lexy::rule_parser<_seq_impl<T...>, NextParser>;
+            return continuation::parse(context, reader, LEXY_FWD(args)...);
+        }
+
+        // Parse them one at a time to report the appropriate error.
+        using parser = lexy::rule_parser<H, lexy::rule_parser<_seq_impl<N, T...>, NextParser>>;
+        return parser::parse(context, reader, LEXY_FWD(args)...);
+    }
+};
 template <>
 struct _seq_impl<>
 {
@@ -32,6 +71,17 @@ struct _seq_impl<H, T...>
     template <typename NextParser>
     struct parser : lexy::rule_parser<H, lexy::rule_parser<_seq_impl<T...>, NextParser>>
     {
+        template <typename Context, typename Reader, typename... Args>
+        LEXY_DSL_FUNC bool parse(Context& context, Reader& reader, Args&&... args)
+        {
+            if constexpr (_seq_can_fuse<Context, Reader, H, T...>)
+                return _seq_fused_parser<NextParser, H, T...>::parse(context, reader,
+                                                                     LEXY_FWD(args)...);
+            else
+                return lexy::rule_parser<H, lexy::rule_parser<_seq_impl<T...>, NextParser>>::
+                    parse(context, reader, LEXY_FWD(args)...);
+        }
+
         // Called by another _seq_impl instantiation.
         template <typename Context, typename Reader, typename... Args>
         LEXY_DSL_FUNC auto _try_parse(Context& context, Reader& reader, Reader save, Args&&... args)
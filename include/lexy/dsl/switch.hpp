@@ -1,10 +1,11 @@
 // Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
-// This file is partialject to the license terms in the LICENSE file
+// This file is subject to the license terms in the LICENSE file
 // found in the top-level directory of this distribution.
 
 #ifndef LEXY_DSL_SWITCH_HPP_INCLUDED
 #define LEXY_DSL_SWITCH_HPP_INCLUDED
 
+#include <lexy/dsl/alternative.hpp>
 #include <lexy/dsl/any.hpp>
 #include <lexy/dsl/base.hpp>
 #include <lexy/dsl/branch.hpp>
@@ -106,6 +107,82 @@ struct _switch_select<NextParser, H, T...>
     }
 };
 
+// Selects the case whose literal is the matched lexeme using a trie, or continues with Fallback.
+template <typename NextParser, typename Fallback, typename... Cases>
+struct _switch_trie_select;
+template <typename NextParser, typename Fallback, typename... Tokens, typename... Values>
+struct _switch_trie_select<NextParser, Fallback, _switch_case<Tokens, Values>...>
+{
+    template <std::size_t... Idx, typename Context, typename Reader, typename... Args>
+    LEXY_DSL_FUNC bool _parse_value(lexy::_detail::index_sequence<Idx...>, std::size_t idx,
+                                    Context& context, Reader& reader, Args&&... args)
+    {
+        auto result = false;
+        (void)((idx == Idx
+                    ? (result = lexy::rule_parser<Values, NextParser>::parse(context, reader,
+                                                                             LEXY_FWD(args)...),
+                       true)
+                    : false)
+               || ...);
+        return result;
+    }
+
+    template <typename Context, typename Reader, typename... Args>
+    LEXY_DSL_FUNC bool parse(Context& context, Reader& reader, Reader save, Args&&... args)
+    {
+        using engine = lexy::engine_trie<_alt_trie<Tokens...>::trie>;
+
+        // We only want to read what the value has matched.
+        // The trie matches the longest case, so it is the entire lexeme if we've reached EOF.
+        auto partial = lexy::partial_reader(save, reader.cur());
+        auto ec      = typename engine::error_code();
+        auto idx     = engine::parse(ec, partial);
+        if (ec == typename engine::error_code() && partial.eof())
+            return _parse_value(lexy::_detail::index_sequence_for<Values...>{}, idx, context,
+                                reader, LEXY_FWD(args)...);
+        else
+            return Fallback::parse(context, reader, save, LEXY_FWD(args)...);
+    }
+};
+
+template <typename Case>
+constexpr bool _switch_is_literal_case = false;
+template <typename Token, typename Value>
+constexpr bool _switch_is_literal_case<_switch_case<Token, Value>> = _can_use_trie<Token>;
+
+template <typename... Tokens, typename... Values>
+LEXY_CONSTEVAL bool _switch_can_use_trie(_alt_impl<_switch_case<Tokens, Values>...>)
+{
+    // We need to reject duplicates: the trie can't represent that the first case is taken.
+    return sizeof...(Tokens) >= 2 && _alt_can_share_trie<Tokens...>;
+}
+
+template <typename NextParser, typename Error, typename... Literals, typename... Cases>
+auto _switch_select_trie(_alt_impl<Literals...>, _alt_impl<Cases...>)
+{
+    if constexpr (_switch_can_use_trie(_alt_impl<Literals...>{}))
+        return _switch_trie_select<NextParser, _switch_select<NextParser, Cases..., Error>,
+                                   Literals...>{};
+    else
+        return _switch_select<NextParser, Literals..., Cases..., Error>{};
+}
+
+// Collects the literal cases at the beginning, they can be selected using a trie.
+template <typename NextParser, typename Error, typename... Literals>
+auto _switch_select_for(_alt_impl<Literals...> lits, _alt_impl<> cases)
+{
+    return _switch_select_trie<NextParser, Error>(lits, cases);
+}
+template <typename NextParser, typename Error, typename... Literals, typename H, typename... T>
+auto _switch_select_for(_alt_impl<Literals...> lits, _alt_impl<H, T...> cases)
+{
+    if constexpr (_switch_is_literal_case<H>)
+        return _switch_select_for<NextParser, Error>(_alt_impl<Literals..., H>{},
+                                                     _alt_impl<T...>{});
+    else
+        return _switch_select_trie<NextParser, Error>(lits, cases);
+}
+
 template <typename Rule, typename Error, typename... Cases>
 struct _switch : rule_base
 {
@@ -117,7 +194,8 @@ struct _switch : rule_base
         {
             // We parse the rule using our special continuation.
             // To recover the old reader position, we create a copy.
-            using cont = _switch_select<NextParser, Cases..., Error>;
+            using cont = decltype(
+                _switch_select_for<NextParser, Error>(_alt_impl<>{}, _alt_impl<Cases...>{}));
             return lexy::rule_parser<Rule, cont>::parse(context, reader, Reader(reader),
                                                         LEXY_FWD(args)...);
         }
@@ -172,14 +172,33 @@ public:
     constexpr key_index try_parse(Reader& reader) const
     {
         static_assert(!empty(), "symbol table must not be empty");
-        using engine = lexy::engine_trie<_lazy::trie>;
-
-        typename engine::error_code ec{};
-        auto                        idx = engine::parse(ec, reader);
-        if (ec == typename engine::error_code())
-            return key_index(idx);
+        using encoding = typename Reader::encoding;
+        if constexpr (lexy::_is_contiguous_byte_reader<Reader> && _is_byte_table<encoding>())
+        {
+            // Every symbol is a single code unit, so a single lookup is enough.
+            auto cur = reader.cur();
+            if (cur == reader._end_pos())
+                return key_index();
+
+            constexpr auto& table = _lazy::template byte_table<encoding>;
+            auto            entry = table.entry[static_cast<unsigned char>(*cur)];
+            if (entry == 0)
+                return key_index();
+
+            reader._seek(cur + 1);
+            return key_index(entry - 1u);
+        }
         else
-            return key_index();
+        {
+            using engine = lexy::engine_trie<_lazy::trie>;
+
+            typename engine::error_code ec{};
+            auto                        idx = engine::parse(ec, reader);
+            if (ec == typename engine::error_code())
+                return key_index(idx);
+            else
+                return key_index();
+        }
     }
 
     constexpr const T& operator[](key_index idx) const noexcept
@@ -189,9 +208,43 @@ public:
     }
 
 private:
+    // Whether every symbol consists of a single code unit of a single byte encoding.
+    template <typename Encoding>
+    static LEXY_CONSTEVAL bool _is_byte_table()
+    {
+        if constexpr (sizeof(typename Encoding::char_type) != 1 || size() >= 256)
+            return false;
+        else
+            return ((Strings::get().size() == 1) && ...);
+    }
+
     struct _lazy
     {
         static constexpr auto trie = lexy::trie<char_type, Strings...>;
+
+        // Maps every code unit to the index of its symbol plus one, or zero.
+        template <typename Encoding>
+        static constexpr auto byte_table = [] {
+            using encoding_char_type = typename Encoding::char_type;
+            constexpr typename Encoding::int_type symbols[]
+                = {lexy::_char_to_int_type<Encoding>(Strings::get()[0])...};
+
+            struct table_t
+            {
+                unsigned char entry[256];
+            } result{};
+            for (auto c = 0u; c != 256u; ++c)
+            {
+                auto cur = Encoding::to_int_type(static_cast<encoding_char_type>(c));
+                for (auto idx = 0u; idx != size(); ++idx)
+                    if (symbols[idx] == cur)
+                    {
+                        result.entry[c] = static_cast<unsigned char>(idx + 1);
+                        break;
+                    }
+            }
+            return result;
+        }();
     };
 
     template <std::size_t... Idx, typename... Args>
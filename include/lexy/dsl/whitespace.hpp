@@ -7,6 +7,7 @@
 
 #include <lexy/action/base.hpp>
 #include <lexy/dsl/base.hpp>
+#include <lexy/dsl/branch.hpp>
 #include <lexy/dsl/choice.hpp>
 #include <lexy/dsl/loop.hpp>
 #include <lexy/dsl/token.hpp>
@@ -81,27 +82,130 @@ struct whitespace_handler
     {}
 };
 
+template <typename Rule>
+constexpr bool _ws_is_token_branch = lexy::is_token_rule<Rule>;
+template <typename Condition, typename... R>
+constexpr bool _ws_is_token_branch<lexyd::_br<Condition, R...>> //
+    = lexy::is_token_rule<Condition> && (lexy::is_token_rule<R> && ...);
+
+// Matches whitespace that consists of alternatives of tokens and branches of tokens,
+// e.g. spaces and comments, without going through the action machinery.
+template <typename H, typename... T>
+struct ws_engine : lexy::engine_matcher_base
+{
+    static constexpr auto can_match = _ws_is_token_branch<H> && (_ws_is_token_branch<T> && ...);
+
+    enum class error_code
+    {
+        // The condition of a branch matched, but not the rest of it.
+        partial_branch = 1,
+    };
+
+    enum class _result
+    {
+        none,
+        matched,
+        error,
+    };
+
+    template <typename Reader, typename Token>
+    static constexpr _result _match(Reader& reader, Token)
+    {
+        using engine = typename Token::token_engine;
+        return lexy::engine_try_match<engine>(reader) ? _result::matched : _result::none;
+    }
+    template <typename Reader, typename Condition, typename... R>
+    static constexpr _result _match(Reader& reader, lexyd::_br<Condition, R...>)
+    {
+        using engine = typename Condition::token_engine;
+        if (!lexy::engine_try_match<engine>(reader))
+            return _result::none;
+        else if ((lexy::engine_try_match<typename R::token_engine>(reader) && ...))
+            return _result::matched;
+        else
+            return _result::error;
+    }
+
+    template <typename Reader>
+    static constexpr error_code match(Reader& reader)
+    {
+        static_assert(can_match);
+        while (true)
+        {
+            auto result = _result::none;
+            if constexpr (lexy::is_token_rule<H>)
+            {
+                // Matching the first alternative repeatedly is the same as matching it in a loop,
+                // which lets us skip runs of e.g. spaces at once.
+                lexy::engine_while<typename H::token_engine>::match(reader);
+                (void)(((result = _match(reader, T{})) == _result::none) && ...);
+            }
+            else
+            {
+                (void)(((result = _match(reader, H{})) == _result::none)
+                       && (((result = _match(reader, T{})) == _result::none) && ...));
+            }
+
+            if (result == _result::none)
+                return error_code();
+            else if (result == _result::error)
+                return error_code::partial_branch;
+        }
+    }
+};
+
+template <typename Rule>
+struct _ws_engine
+{
+    using type = ws_engine<Rule>;
+};
+template <typename... R>
+struct _ws_engine<lexyd::_chc<R...>>
+{
+    using type = ws_engine<R...>;
+};
+
 template <typename Rule, typename NextParser>
 struct manual_ws_parser
 {
-    template <typename Context, typename Reader, typename... Args>
-    LEXY_DSL_FUNC bool parse(Context& context, Reader& reader, Args&&... args)
+    template <typename Context, typename Reader>
+    LEXY_DSL_FUNC bool _skip(Context& context, Reader& reader)
     {
-        auto begin = reader.cur();
         if constexpr (lexy::is_token_rule<Rule>)
         {
             // Parsing a token repeatedly cannot fail, so we can optimize it using an engine.
             using engine = lexy::engine_while<typename Rule::token_engine>;
             engine::match(reader);
+            return true;
         }
         else
         {
+            using engine = typename _ws_engine<Rule>::type;
+            if constexpr (engine::can_match)
+            {
+                // Alternatives of tokens can also be matched using an engine,
+                // as long as there is no error to report.
+                auto save = reader;
+                if (engine::match(reader) == typename engine::error_code())
+                    return true;
+
+                // Parse it again below to report the error.
+                reader = LEXY_MOV(save);
+            }
+
             // Parse the rule using a special handler that only forwards errors.
             using production = ws_production<Rule>;
             whitespace_handler<Context> ws_handler{&context};
-            if (!lexy::do_action<production>(LEXY_MOV(ws_handler), reader))
-                return false;
+            return lexy::do_action<production>(LEXY_MOV(ws_handler), reader);
         }
+    }
+
+    template <typename Context, typename Reader, typename... Args>
+    LEXY_DSL_FUNC bool parse(Context& context, Reader& reader, Args&&... args)
+    {
+        auto begin = reader.cur();
+        if (!_skip(context, reader))
+            return false;
         auto end = reader.cur();
 
         // Add a whitespace token node.
@@ -250,6 +250,22 @@ constexpr bool _is_ascii(CharT c)
         return c <= 0x7F;
 }
 
+// Whether the integer value of a single byte encoding can be cast to unsigned char to recover the
+// code unit. This is trivially true if the int_type is a single byte itself, EOF included.
+template <typename Encoding>
+constexpr bool _is_byte(typename Encoding::int_type i)
+{
+    using int_type = typename Encoding::int_type;
+    static_assert(sizeof(typename Encoding::char_type) == 1);
+
+    if constexpr (sizeof(int_type) == 1)
+        return true;
+    else if constexpr (std::is_signed_v<int_type>)
+        return 0 <= i && i <= 0xFF;
+    else
+        return i <= 0xFF;
+}
+
 template <typename Encoding, typename CharT>
 LEXY_CONSTEVAL auto _char_to_int_type(CharT c)
 {
@@ -6,7 +6,9 @@
 #define LEXY_ENGINE_BASE_HPP_INCLUDED
 
 #include <lexy/_detail/assert.hpp>
+#include <lexy/_detail/byte_set.hpp>
 #include <lexy/_detail/config.hpp>
+#include <lexy/_detail/detect.hpp>
 #include <lexy/input/base.hpp>
 
 #if 0
@@ -28,6 +30,15 @@ struct Matcher : engine_matcher_base
     /// If not possible, keeps input at the error position and returns false.
     template <typename Reader>
     static bool recover(Reader& reader, error_code ec);
+
+    /// The code units of a single byte encoding a successful match can start with (optional).
+    /// If the matcher can succeed without consuming anything, this must be all code units.
+    static consteval _detail::byte_set first_bytes();
+
+    /// Whether the matcher matches the given code unit (optional).
+    /// This must only be provided if the matcher always consumes exactly one code unit.
+    template <typename Encoding>
+    static bool char_class(typename Encoding::int_type cur);
 };
 
 /// Parses something, i.e. consumes and input and returns a result or error.
@@ -82,6 +93,61 @@ constexpr bool engine_can_fail = true;
 /// Whether or not the engine can succeed on the given input.
 template <typename Engine, typename Reader>
 constexpr bool engine_can_succeed = true;
+
+template <typename Engine>
+using _detect_first_bytes = decltype(Engine::first_bytes());
+
+/// The code units of a single byte encoding a successful match of the engine can start with.
+/// If the engine doesn't specify them, every code unit is possible.
+template <typename Engine>
+constexpr auto engine_first_bytes = [] {
+    if constexpr (_detail::is_detected<_detect_first_bytes, Engine>)
+        return Engine::first_bytes();
+    else
+        return _detail::byte_set::all();
+}();
+
+template <typename Engine, typename Encoding>
+using _detect_char_class
+    = decltype(Engine::template char_class<Encoding>(typename Encoding::int_type()));
+
+/// Whether the engine matches exactly one code unit as given by its char class.
+template <typename Engine, typename Encoding>
+constexpr bool engine_is_char_class = _detail::is_detected<_detect_char_class, Engine, Encoding>;
+
+/// The code units of a single byte encoding that are matched by a char class engine.
+template <typename Engine, typename Encoding>
+constexpr auto engine_char_class = [] {
+    static_assert(engine_is_char_class<Engine, Encoding>
+                  && sizeof(typename Encoding::char_type) == 1);
+    using char_type = typename Encoding::char_type;
+
+    _detail::byte_set result;
+    for (auto c = 0u; c != 256u; ++c)
+        if (Engine::template char_class<Encoding>(
+                Encoding::to_int_type(static_cast<char_type>(c))))
+            result.insert(static_cast<unsigned char>(c));
+    return result;
+}();
+
+template <typename Engine, typename Encoding>
+using _detect_single_bytes = decltype(Engine::template _single_bytes<Encoding>());
+
+// The code units of a single byte encoding that are a complete match on their own:
+// on input starting with one of them, the engine matches exactly that code unit.
+// dsl::delimited() only combines them into runs if it also knows the first bytes of the closing
+// delimiter, the limit and all escapes; otherwise, every character is still parsed separately.
+template <typename Engine, typename Encoding>
+constexpr auto _engine_single_bytes = [] {
+    if constexpr (sizeof(typename Encoding::char_type) != 1)
+        return _detail::byte_set();
+    else if constexpr (engine_is_char_class<Engine, Encoding>)
+        return engine_char_class<Engine, Encoding>;
+    else if constexpr (_detail::is_detected<_detect_single_bytes, Engine, Encoding>)
+        return Engine::template _single_bytes<Encoding>();
+    else
+        return _detail::byte_set();
+}();
 } // namespace lexy
 
 namespace lexy
@@ -114,6 +180,49 @@ constexpr bool engine_peek(Reader reader)
 {
     return Matcher::match(reader) == typename Matcher::error_code();
 }
+
+/// Advances the reader to the next code unit that is in the set, or EOF.
+/// This only happens for contiguous readers of single byte encodings, it does nothing otherwise.
+template <const auto& Set, typename Reader>
+constexpr void engine_skip_to(Reader& reader)
+{
+    if constexpr (_is_contiguous_byte_reader<Reader> && !Set.is_all())
+        reader._seek(_detail::find_first_of<Set, _reader_padding<Reader>>(reader.cur(),
+                                                                        reader._end_pos()));
+}
+
+template <typename Engine, typename Encoding>
+using _detect_find = decltype(Engine::template _can_find<Encoding>());
+
+// Whether the engine can search for its next match directly, like engine_literal or engine_trie.
+template <typename Engine, typename Encoding>
+constexpr bool _engine_can_find = [] {
+    if constexpr (_detail::is_detected<_detect_find, Engine, Encoding>)
+        return Engine::template _can_find<Encoding>();
+    else
+        return false;
+}();
+
+// Advances the reader to the next position where Condition might match, or EOF.
+template <typename Condition, typename Reader>
+constexpr void _engine_skip_to_candidate(Reader& reader)
+{
+    using encoding = typename Reader::encoding;
+    if constexpr (_is_contiguous_byte_reader<Reader> && _engine_can_find<Condition, encoding>)
+        reader._seek(Condition::template _find<encoding>(reader.cur(), reader._end_pos()));
+    else
+        engine_skip_to<engine_first_bytes<Condition>>(reader);
+}
+
+/// Advances the reader to the next code unit that is not in the set, or EOF.
+/// This must only be used on contiguous readers of single byte encodings.
+template <const auto& Set, typename Reader>
+constexpr void engine_skip_while(Reader& reader)
+{
+    static_assert(_is_contiguous_byte_reader<Reader>);
+    reader._seek(
+        _detail::find_first_not_of<Set, _reader_padding<Reader>>(reader.cur(), reader._end_pos()));
+}
 } // namespace lexy
 
 #endif // LEXY_ENGINE_BASE_HPP_INCLUDED
@@ -20,13 +20,16 @@ struct engine_char_range : engine_matcher_base
         error = 1,
     };
 
+    template <typename Encoding>
+    static constexpr bool char_class(typename Encoding::int_type cur)
+    {
+        return _char_to_int_type<Encoding>(Min) <= cur && cur <= _char_to_int_type<Encoding>(Max);
+    }
+
     template <typename Reader>
     static constexpr error_code match(Reader& reader)
     {
-        using encoding = typename Reader::encoding;
-
-        auto cur = reader.peek();
-        if (_char_to_int_type<encoding>(Min) <= cur && cur <= _char_to_int_type<encoding>(Max))
+        if (char_class<typename Reader::encoding>(reader.peek()))
         {
             reader.bump();
             return error_code();
@@ -43,6 +46,21 @@ struct engine_char_range : engine_matcher_base
             reader.bump();
         return true;
     }
+
+    static LEXY_CONSTEVAL auto first_bytes()
+    {
+        auto to_int = [](auto c) {
+            if constexpr (sizeof(c) == 1)
+                return int(static_cast<unsigned char>(c));
+            else
+                return int(c);
+        };
+
+        _detail::byte_set result;
+        for (auto c = to_int(Min); c <= to_int(Max); ++c)
+            _detail::insert_char(result, c);
+        return result;
+    }
 };
 } // namespace lexy
 
@@ -51,6 +69,11 @@ namespace lexy
 template <typename CharT, std::size_t TransitionCount>
 struct _strie
 {
+    LEXY_CONSTEVAL std::size_t transition_count() const
+    {
+        return TransitionCount;
+    }
+
     LEXY_CONSTEVAL auto transition_sequence() const
     {
         return lexy::_detail::make_index_sequence<TransitionCount>{};
@@ -93,24 +116,52 @@ struct engine_char_set : engine_matcher_base
         error = 1,
     };
 
-    template <typename Reader, std::size_t... Transitions>
-    static constexpr auto _transition(Reader& reader, lexy::_detail::index_sequence<Transitions...>)
+    template <typename Encoding, std::size_t... Transitions>
+    static constexpr bool _transition(typename Encoding::int_type cur,
+                                      lexy::_detail::index_sequence<Transitions...>)
     {
-        using encoding = typename Reader::encoding;
+        return ((cur == STrie.template transition<Encoding>(Transitions)) || ...);
+    }
 
-        auto cur     = reader.peek();
-        auto matches = ((cur == STrie.template transition<encoding>(Transitions)) || ...);
-        if (!matches)
-            return error_code::error;
+    // Above this size, a lookup in a bitmap is cheaper than comparing with every character.
+    static constexpr auto _bitmap_threshold = std::size_t(4);
 
-        reader.bump();
-        return error_code();
+    template <typename Encoding>
+    static constexpr auto _bitmap = [] {
+        using char_type = typename Encoding::char_type;
+
+        _detail::byte_set result;
+        for (auto c = 0u; c != 256u; ++c)
+            if (_transition<Encoding>(Encoding::to_int_type(static_cast<char_type>(c)),
+                                      STrie.transition_sequence()))
+                result.insert(static_cast<unsigned char>(c));
+        return result;
+    }();
+
+    template <typename Encoding>
+    static constexpr bool char_class(typename Encoding::int_type cur)
+    {
+        if constexpr (sizeof(typename Encoding::char_type) == 1
+                      && STrie.transition_count() > _bitmap_threshold)
+        {
+            // Values that aren't bytes (i.e. EOF) don't match, as they aren't in the set.
+            return _is_byte<Encoding>(cur)
+                   && _bitmap<Encoding>.contains(static_cast<unsigned char>(cur));
+        }
+        else
+        {
+            return _transition<Encoding>(cur, STrie.transition_sequence());
+        }
     }
 
     template <typename Reader>
     static constexpr error_code match(Reader& reader)
     {
-        return _transition(reader, STrie.transition_sequence());
+        if (!char_class<typename Reader::encoding>(reader.peek()))
+            return error_code::error;
+
+        reader.bump();
+        return error_code();
     }
 
     template <typename Reader>
@@ -121,6 +172,14 @@ struct engine_char_set : engine_matcher_base
             reader.bump();
         return true;
     }
+
+    static LEXY_CONSTEVAL auto first_bytes()
+    {
+        _detail::byte_set result;
+        for (auto i = 0u; i != STrie.transition_count(); ++i)
+            _detail::insert_char(result, STrie._transition[i]);
+        return result;
+    }
 };
 
 } // namespace lexy
@@ -203,11 +262,16 @@ struct engine_ascii_table : engine_matcher_base
         error = 1,
     };
 
+    template <typename Encoding>
+    static constexpr bool char_class(typename Encoding::int_type cur)
+    {
+        return Table.template contains<Encoding, Categories...>(cur);
+    }
+
     template <typename Reader>
     static constexpr error_code match(Reader& reader)
     {
-        auto cur = reader.peek();
-        if (Table.template contains<typename Reader::encoding, Categories...>(cur))
+        if (char_class<typename Reader::encoding>(reader.peek()))
         {
             reader.bump();
             return error_code();
@@ -226,6 +290,15 @@ struct engine_ascii_table : engine_matcher_base
             reader.bump();
         return true;
     }
+
+    static LEXY_CONSTEVAL auto first_bytes()
+    {
+        _detail::byte_set result;
+        for (auto c = 0; c <= 0x7F; ++c)
+            if (Table.template contains<default_encoding, Categories...>(c))
+                result.insert(static_cast<unsigned char>(c));
+        return result;
+    }
 };
 } // namespace lexy
 
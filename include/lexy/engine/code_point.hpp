@@ -93,10 +93,44 @@ struct engine_cp_utf8 : engine_matcher_base, engine_parser_base
 
     using error_code = _cp_error_code;
 
+    template <typename Reader>
+    static constexpr code_point _parse_validated(error_code& ec, Reader& reader)
+    {
+        auto first = reader.peek();
+        if ((first & ~payload_lead1) == pattern_lead1)
+        {
+            // ASCII character.
+            reader.bump();
+            return code_point(first);
+        }
+        else if (first == utf8_encoding::eof())
+        {
+            ec = error_code::eof;
+            return code_point();
+        }
+
+        // The input is well-formed, so the lead byte alone determines the number of trailing
+        // code units, and they don't need to be checked.
+        auto trailing = first >= pattern_lead4 ? 3 : first >= pattern_lead3 ? 2 : 1;
+        auto result   = char32_t(first & (payload_lead1 >> (trailing + 1)));
+        reader.bump();
+
+        for (auto i = 0; i != trailing; ++i)
+        {
+            result <<= 6;
+            result |= char32_t(reader.peek() & payload_cont);
+            reader.bump();
+        }
+
+        return code_point(result);
+    }
+
     template <typename Reader>
     static constexpr code_point parse(error_code& ec, Reader& reader)
     {
         static_assert(std::is_same_v<typename Reader::encoding, utf8_encoding>);
+        if constexpr (_is_validated_utf8_reader<Reader>)
+            return _parse_validated(ec, reader);
 
         auto first = reader.peek();
         if ((first & ~payload_lead1) == pattern_lead1)
@@ -247,6 +281,140 @@ struct engine_cp_utf8 : engine_matcher_base, engine_parser_base
     }
 };
 
+// State transition table for decoding UTF-8.
+// It only checks the structure of the code units; the decoded value is checked afterwards.
+struct _cp_utf8_dfa
+{
+    enum type_t : unsigned char
+    {
+        ascii,
+        trailing,
+        lead2,
+        lead3,
+        lead4,
+        invalid,
+        _type_count,
+    };
+    enum state_t : unsigned char
+    {
+        accept,
+        need1,
+        need2,
+        need3,
+        reject,
+        _state_count,
+    };
+
+    type_t   type[256];
+    state_t  transition[_state_count][_type_count];
+    unsigned payload[_type_count];
+    char32_t min_value[_type_count];
+};
+
+constexpr auto _cp_utf8_dfa_table = [] {
+    using dfa = _cp_utf8_dfa;
+    dfa result{};
+
+    for (auto c = 0u; c != 256u; ++c)
+    {
+        if (c < 0x80)
+            result.type[c] = dfa::ascii;
+        else if (c < 0xC0)
+            result.type[c] = dfa::trailing;
+        else if (c < 0xE0)
+            result.type[c] = dfa::lead2;
+        else if (c < 0xF0)
+            result.type[c] = dfa::lead3;
+        else if (c < 0xF8)
+            result.type[c] = dfa::lead4;
+        else
+            result.type[c] = dfa::invalid;
+    }
+
+    for (auto& row : result.transition)
+        for (auto& next : row)
+            next = dfa::reject;
+    result.transition[dfa::accept][dfa::ascii] = dfa::accept;
+    result.transition[dfa::accept][dfa::lead2] = dfa::need1;
+    result.transition[dfa::accept][dfa::lead3] = dfa::need2;
+    result.transition[dfa::accept][dfa::lead4] = dfa::need3;
+    result.transition[dfa::need1][dfa::trailing] = dfa::accept;
+    result.transition[dfa::need2][dfa::trailing] = dfa::need1;
+    result.transition[dfa::need3][dfa::trailing] = dfa::need2;
+
+    result.payload[dfa::ascii] = engine_cp_utf8::payload_lead1;
+    result.payload[dfa::lead2] = engine_cp_utf8::payload_lead2;
+    result.payload[dfa::lead3] = engine_cp_utf8::payload_lead3;
+    result.payload[dfa::lead4] = engine_cp_utf8::payload_lead4;
+
+    // Anything below that could have been encoded using fewer code units.
+    result.min_value[dfa::lead2] = 0x80;
+    result.min_value[dfa::lead3] = 0x800;
+    result.min_value[dfa::lead4] = 0x10000;
+
+    return result;
+}();
+
+/// Matches a UTF-8 code point, decoding it using a state transition table.
+/// It has the same results as engine_cp_utf8, but doesn't branch on the kind of code unit.
+struct engine_cp_utf8_table : engine_cp_utf8
+{
+    template <typename Reader>
+    static constexpr code_point parse(error_code& ec, Reader& reader)
+    {
+        static_assert(std::is_same_v<typename Reader::encoding, utf8_encoding>);
+        if constexpr (_is_validated_utf8_reader<Reader>)
+            return _parse_validated(ec, reader);
+
+        using dfa             = _cp_utf8_dfa;
+        constexpr auto& table = _cp_utf8_dfa_table;
+
+        // EOF is 0xFF, which is an invalid code unit.
+        auto first = static_cast<unsigned char>(reader.peek());
+        auto type  = table.type[first];
+        auto state = table.transition[dfa::accept][type];
+        if (state == dfa::reject)
+        {
+            ec = type == dfa::trailing ? error_code::leads_with_trailing : error_code::eof;
+            return code_point();
+        }
+        reader.bump();
+
+        auto result = char32_t(first & table.payload[type]);
+        while (state != dfa::accept)
+        {
+            auto cur = static_cast<unsigned char>(reader.peek());
+            state    = table.transition[state][table.type[cur]];
+            if (state == dfa::reject)
+            {
+                ec = error_code::missing_trailing;
+                return code_point();
+            }
+            reader.bump();
+
+            result <<= 6;
+            result |= char32_t(cur & payload_cont);
+        }
+
+        auto cp = code_point(result);
+        if (!cp.is_valid())
+            ec = error_code::out_of_range;
+        else if (result < table.min_value[type])
+            ec = error_code::overlong_sequence;
+        else if (cp.is_surrogate())
+            ec = error_code::surrogate;
+        return cp;
+    }
+
+    template <typename Reader>
+    static constexpr error_code match(Reader& reader)
+    {
+        error_code result{};
+        parse(result, reader);
+        return result;
+    }
+};
+
 /// Matches a UTF-16 code point.
 struct engine_cp_utf16 : engine_matcher_base, engine_parser_base
 {
@@ -291,7 +459,7 @@ struct engine_cp_utf16 : engine_matcher_base, engine_parser_base
             auto result = char32_t(first & payload1);
             result <<= 10;
             result |= char32_t(second & payload2);
-            result |= 0x10000;
+            result += 0x10000;
             return code_point(result);
         }
         else if ((first & ~payload2) == pattern2)
@@ -340,6 +508,115 @@ struct engine_cp_utf16 : engine_matcher_base, engine_parser_base
     }
 };
 
+// State transition table for decoding UTF-16, indexed by the upper six bits of a code unit.
+struct _cp_utf16_dfa
+{
+    enum type_t : unsigned char
+    {
+        single,
+        lead,
+        trailing,
+        _type_count,
+    };
+    enum state_t : unsigned char
+    {
+        accept,
+        need1,
+        reject,
+        _state_count,
+    };
+
+    type_t   type[64];
+    state_t  transition[_state_count][_type_count];
+    unsigned payload[_type_count];
+    char32_t offset[_type_count];
+};
+
+constexpr auto _cp_utf16_dfa_table = [] {
+    using dfa = _cp_utf16_dfa;
+    dfa result{};
+
+    for (auto& type : result.type)
+        type = dfa::single;
+    result.type[engine_cp_utf16::pattern1 >> 10] = dfa::lead;
+    result.type[engine_cp_utf16::pattern2 >> 10] = dfa::trailing;
+
+    for (auto& row : result.transition)
+        for (auto& next : row)
+            next = dfa::reject;
+    result.transition[dfa::accept][dfa::single]  = dfa::accept;
+    result.transition[dfa::accept][dfa::lead]    = dfa::need1;
+    result.transition[dfa::need1][dfa::trailing] = dfa::accept;
+
+    result.payload[dfa::single] = 0xFFFF;
+    result.payload[dfa::lead]   = engine_cp_utf16::payload1;
+    result.offset[dfa::lead]    = 0x10000;
+
+    return result;
+}();
+
+/// Matches a UTF-16 code point, decoding it using a state transition table.
+/// It has the same results as engine_cp_utf16, but doesn't branch on the kind of code unit.
+struct engine_cp_utf16_table : engine_cp_utf16
+{
+    template <typename Reader>
+    static constexpr code_point parse(error_code& ec, Reader& reader)
+    {
+        static_assert(std::is_same_v<typename Reader::encoding, utf16_encoding>);
+
+        using dfa             = _cp_utf16_dfa;
+        constexpr auto& table = _cp_utf16_dfa_table;
+
+        if (reader.eof())
+        {
+            ec = error_code::eof;
+            return code_point();
+        }
+
+        auto first = char16_t(reader.peek());
+        auto type  = table.type[first >> 10];
+        auto state = table.transition[dfa::accept][type];
+        if (state == dfa::reject)
+        {
+            ec = error_code::leads_with_trailing;
+            return code_point();
+        }
+        reader.bump();
+
+        auto result = char32_t(first & table.payload[type]);
+        while (state != dfa::accept)
+        {
+            if (reader.eof())
+            {
+                ec = error_code::missing_trailing;
+                return code_point();
+            }
+
+            auto cur = char16_t(reader.peek());
+            state    = table.transition[state][table.type[cur >> 10]];
+            if (state == dfa::reject)
+            {
+                ec = error_code::missing_trailing;
+                return code_point();
+            }
+            reader.bump();
+
+            result <<= 10;
+            result |= char32_t(cur & payload2);
+        }
+
+        return code_point(result + table.offset[type]);
+    }
+
+    template <typename Reader>
+    static constexpr error_code match(Reader& reader)
+    {
+        error_code result{};
+        parse(result, reader);
+        return result;
+    }
+};
+
 /// Matches a UTF-32 code point.
 struct engine_cp_utf32 : engine_matcher_base, engine_parser_base
 {
@@ -398,64 +675,60 @@ struct engine_cp_utf32 : engine_matcher_base, engine_parser_base
     }
 };
 
+/// Whether engine_cp_auto decodes code points of the encoding using a state transition table.
+/// This is possible for UTF-8 and UTF-16; specialize it to select the decoder.
+template <typename Encoding>
+constexpr bool engine_cp_use_table = false;
+
 /// Matches a code point according to the inputs encoding.
 struct engine_cp_auto : lexy::engine_matcher_base, lexy::engine_parser_base
 {
     using error_code = _cp_error_code;
 
-    template <typename Reader>
-    static constexpr code_point parse(error_code& ec, Reader& reader)
+    template <typename Encoding>
+    static auto _engine()
     {
-        using encoding = typename Reader::encoding;
-        if constexpr (std::is_same_v<encoding, lexy::ascii_encoding>)
-            return engine_cp_ascii::parse(ec, reader);
-        else if constexpr (std::is_same_v<encoding, lexy::utf8_encoding>)
-            return engine_cp_utf8::parse(ec, reader);
-        else if constexpr (std::is_same_v<encoding, lexy::utf16_encoding>)
-            return engine_cp_utf16::parse(ec, reader);
-        else if constexpr (std::is_same_v<encoding, lexy::utf32_encoding>)
-            return engine_cp_utf32::parse(ec, reader);
+        if constexpr (std::is_same_v<Encoding, lexy::ascii_encoding>)
+            return engine_cp_ascii{};
+        else if constexpr (std::is_same_v<Encoding, lexy::utf8_encoding>)
+        {
+            if constexpr (engine_cp_use_table<Encoding>)
+                return engine_cp_utf8_table{};
+            else
+                return engine_cp_utf8{};
+        }
+        else if constexpr (std::is_same_v<Encoding, lexy::utf16_encoding>)
+        {
+            if constexpr (engine_cp_use_table<Encoding>)
+                return engine_cp_utf16_table{};
+            else
+                return engine_cp_utf16{};
+        }
+        else if constexpr (std::is_same_v<Encoding, lexy::utf32_encoding>)
+            return engine_cp_utf32{};
         else
-            static_assert(lexy::_detail::error<encoding>,
+            static_assert(lexy::_detail::error<Encoding>,
                           "no code point defined for this encoding");
     }
+    template <typename Reader>
+    using _engine_for = decltype(_engine<typename Reader::encoding>());
 
     template <typename Reader>
-    static constexpr error_code match(Reader& reader)
+    static constexpr code_point parse(error_code& ec, Reader& reader)
     {
-        error_code result{};
-
-        using encoding = typename Reader::encoding;
-        if constexpr (std::is_same_v<encoding, lexy::ascii_encoding>)
-            engine_cp_ascii::parse(result, reader);
-        else if constexpr (std::is_same_v<encoding, lexy::utf8_encoding>)
-            engine_cp_utf8::parse(result, reader);
-        else if constexpr (std::is_same_v<encoding, lexy::utf16_encoding>)
-            engine_cp_utf16::parse(result, reader);
-        else if constexpr (std::is_same_v<encoding, lexy::utf32_encoding>)
-            engine_cp_utf32::parse(result, reader);
-        else
-            static_assert(lexy::_detail::error<encoding>,
-                          "no code point defined for this encoding");
+        return _engine_for<Reader>::parse(ec, reader);
+    }
 
-        return result;
+    template <typename Reader>
+    static constexpr error_code match(Reader& reader)
+    {
+        return _engine_for<Reader>::match(reader);
     }
 
     template <typename Reader>
     static constexpr bool recover(Reader& reader, error_code ec)
     {
-        using encoding = typename Reader::encoding;
-        if constexpr (std::is_same_v<encoding, lexy::ascii_encoding>)
-            return engine_cp_ascii::recover(reader, ec);
-        else if constexpr (std::is_same_v<encoding, lexy::utf8_encoding>)
-            return engine_cp_utf8::recover(reader, ec);
-        else if constexpr (std::is_same_v<encoding, lexy::utf16_encoding>)
-            return engine_cp_utf16::recover(reader, ec);
-        else if constexpr (std::is_same_v<encoding, lexy::utf32_encoding>)
-            return engine_cp_utf32::recover(reader, ec);
-        else
-            static_assert(lexy::_detail::error<encoding>,
-                          "no code point defined for this encoding");
+        return _engine_for<Reader>::recover(reader, ec);
     }
 };
 } // namespace lexy
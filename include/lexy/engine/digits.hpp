@@ -6,6 +6,7 @@
 #define LEXY_ENGINE_DIGITS_HPP_INCLUDED
 
 #include <lexy/engine/base.hpp>
+#include <lexy/engine/while.hpp>
 
 namespace lexy
 {
@@ -25,11 +26,15 @@ struct engine_digits : engine_matcher_base
             return ec;
 
         // Match subsequent digits as often as possible.
-        while (engine_try_match<DigitSet>(reader))
-        {}
+        engine_while<DigitSet>::match(reader);
 
         return error_code();
     }
+
+    static LEXY_CONSTEVAL auto first_bytes()
+    {
+        return engine_first_bytes<DigitSet>;
+    }
 };
 
 /// Match one or more of the specified digits with digit separator in between.
@@ -62,6 +67,11 @@ struct engine_digits_sep : engine_matcher_base
 
         return error_code();
     }
+
+    static LEXY_CONSTEVAL auto first_bytes()
+    {
+        return engine_first_bytes<DigitSet>;
+    }
 };
 } // namespace lexy
 
@@ -102,12 +112,18 @@ struct engine_digits_trimmed : engine_matcher_base
                 return translate(ec);
 
             // Match subsequent digits as often as possible.
-            while (engine_try_match<DigitSet>(reader))
-            {}
+            engine_while<DigitSet>::match(reader);
 
             return error_code();
         }
     }
+
+    static LEXY_CONSTEVAL auto first_bytes()
+    {
+        auto result = engine_first_bytes<DigitSet>;
+        result.insert(engine_first_bytes<Zero>);
+        return result;
+    }
 };
 
 /// Match one or more of the specified digits optionally separated, trimmed from unnecessary leading
@@ -162,6 +178,13 @@ struct engine_digits_trimmed_sep : engine_matcher_base
             return error_code();
         }
     }
+
+    static LEXY_CONSTEVAL auto first_bytes()
+    {
+        auto result = engine_first_bytes<DigitSet>;
+        result.insert(engine_first_bytes<Zero>);
+        return result;
+    }
 };
 } // namespace lexy
 
@@ -209,6 +232,11 @@ struct engine_ndigits : engine_matcher_base
 
         return error_code();
     }
+
+    static LEXY_CONSTEVAL auto first_bytes()
+    {
+        return engine_first_bytes<DigitSet>;
+    }
 };
 
 /// Matches exactly N digits optionally separated.
@@ -262,6 +290,11 @@ struct engine_ndigits_sep : engine_matcher_base
 
         return error_code();
     }
+
+    static LEXY_CONSTEVAL auto first_bytes()
+    {
+        return engine_first_bytes<DigitSet>;
+    }
 };
 } // namespace lexy
 
@@ -22,6 +22,12 @@ struct engine_eof : engine_matcher_base
     {
         return reader.eof() ? error_code() : error_code::error;
     }
+
+    static LEXY_CONSTEVAL auto first_bytes()
+    {
+        // We only match at EOF, never on an actual code unit.
+        return _detail::byte_set();
+    }
 };
 } // namespace lexy
 
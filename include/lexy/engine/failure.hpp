@@ -22,6 +22,11 @@ struct engine_failure : engine_matcher_base
     {
         return error_code::error;
     }
+
+    static LEXY_CONSTEVAL auto first_bytes()
+    {
+        return _detail::byte_set();
+    }
 };
 
 template <typename Reader>
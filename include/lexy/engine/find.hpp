@@ -23,15 +23,20 @@ struct engine_find : engine_matcher_base
     template <typename Reader>
     static constexpr error_code match(Reader& reader)
     {
-        while (!engine_peek<Condition>(reader))
+        while (true)
         {
-            if (reader.eof())
+            // Skip over everything that can't be the beginning of Condition.
+            _engine_skip_to_candidate<Condition>(reader);
+
+            if (engine_peek<Condition>(reader))
+                return error_code();
+            else if (reader.eof())
                 return error_code::not_found;
             else
                 reader.bump();
         }
 
-        return error_code();
+        return error_code(); // unreachable
     }
 };
 
@@ -48,12 +53,20 @@ struct engine_find_before : engine_matcher_base
         not_found_limit,
     };
 
+    static constexpr auto _first_bytes
+        = _detail::byte_set(engine_first_bytes<Condition>).insert(engine_first_bytes<Limit>);
+
     template <typename Reader>
     static constexpr error_code match(Reader& reader)
     {
-        while (!engine_peek<Condition>(reader))
+        while (true)
         {
-            if (reader.eof())
+            // Skip over everything that can't be the beginning of Condition or Limit.
+            engine_skip_to<_first_bytes>(reader);
+
+            if (engine_peek<Condition>(reader))
+                return error_code();
+            else if (reader.eof())
                 return error_code::not_found_eof;
             else if (engine_peek<Limit>(reader))
                 return error_code::not_found_limit;
@@ -61,7 +74,7 @@ struct engine_find_before : engine_matcher_base
                 reader.bump();
         }
 
-        return error_code();
+        return error_code(); // unreachable
     }
 };
 } // namespace lexy
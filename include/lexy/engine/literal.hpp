@@ -6,6 +6,7 @@
 #define LEXY_ENGINE_LITERAL_HPP_INCLUDED
 
 #include <lexy/_detail/integer_sequence.hpp>
+#include <lexy/_detail/swar.hpp>
 #include <lexy/engine/base.hpp>
 
 namespace lexy
@@ -18,6 +19,11 @@ struct _ltrie
         return NodeCount == 0;
     }
 
+    LEXY_CONSTEVAL std::size_t size() const
+    {
+        return NodeCount;
+    }
+
     LEXY_CONSTEVAL auto node_sequence() const
     {
         return lexy::_detail::make_index_sequence<NodeCount>{};
@@ -50,6 +56,25 @@ LEXY_CONSTEVAL auto _make_ltrie()
 template <typename String>
 constexpr auto linear_trie = _make_ltrie<String>();
 
+template <const auto& Lhs, const auto& Rhs>
+LEXY_CONSTEVAL auto _concat_ltrie()
+{
+    using char_type = std::remove_const_t<std::remove_reference_t<decltype(Lhs._transition[0])>>;
+    using ltrie_t   = _ltrie<char_type, Lhs.size() + Rhs.size()>;
+    ltrie_t result{};
+
+    for (auto idx = 0u; idx != Lhs.size(); ++idx)
+        result._transition[idx] = Lhs._transition[idx];
+    for (auto idx = 0u; idx != Rhs.size(); ++idx)
+        result._transition[Lhs.size() + idx] = Rhs._transition[idx];
+
+    return result;
+}
+
+/// Produces a linear trie that matches the string of `Lhs` followed by the one of `Rhs`.
+template <const auto& Lhs, const auto& Rhs>
+constexpr auto concat_linear_trie = _concat_ltrie<Lhs, Rhs>();
+
 /// Matches the linear trie.
 template <const auto& LTrie>
 struct engine_literal : engine_matcher_base
@@ -81,11 +106,165 @@ struct engine_literal : engine_matcher_base
         return result;
     }
 
+    // Literals with at least that many code units are compared a word at a time.
+    static constexpr auto _word_threshold = std::size_t(4);
+    static constexpr auto _word_count
+        = (LTrie.size() + _detail::swar_length - 1) / _detail::swar_length;
+
+    template <typename Encoding>
+    static LEXY_CONSTEVAL auto _code_unit(std::size_t idx)
+    {
+        return static_cast<typename Encoding::char_type>(LTrie._transition[idx]);
+    }
+
+    // Whether the literal consists of single byte code units only.
+    template <typename Encoding>
+    static LEXY_CONSTEVAL bool _is_bytes()
+    {
+        if constexpr (sizeof(typename Encoding::char_type) != 1)
+            return false;
+        else
+        {
+            // Every character needs to be a single code unit, otherwise it can never match.
+            for (auto idx = 0u; idx != LTrie.size(); ++idx)
+                if (Encoding::to_int_type(_code_unit<Encoding>(idx))
+                    != LTrie.template transition<Encoding>(idx))
+                    return false;
+            return true;
+        }
+    }
+
+    template <typename Encoding>
+    static LEXY_CONSTEVAL bool _can_compare_words()
+    {
+        return LTrie.size() >= _word_threshold && _is_bytes<Encoding>();
+    }
+
+    // Whether we can compare the words without checking the size of the input first.
+    // If the literal extends into the padding, it would need to contain 0xFF to match.
+    template <typename Reader>
+    static LEXY_CONSTEVAL bool _can_compare_padded()
+    {
+        using encoding = typename Reader::encoding;
+        if (_reader_padding<Reader> < LTrie.size())
+            return false;
+
+        for (auto idx = 0u; idx != LTrie.size(); ++idx)
+            if (static_cast<unsigned char>(_code_unit<encoding>(idx)) == 0xFF)
+                return false;
+        return true;
+    }
+
+    template <typename Encoding>
+    static LEXY_CONSTEVAL auto _make_words()
+    {
+        struct words_t
+        {
+            _detail::swar_int data[_word_count == 0 ? 1 : _word_count];
+        } result{};
+
+        for (auto idx = 0u; idx != LTrie.size(); ++idx)
+        {
+            auto c = static_cast<unsigned char>(_code_unit<Encoding>(idx));
+            result.data[idx / _detail::swar_length]
+                |= _detail::swar_int(c) << (idx % _detail::swar_length * CHAR_BIT);
+        }
+
+        return result;
+    }
+
+    template <typename Encoding>
+    static constexpr auto _words = _make_words<Encoding>();
+
+    template <typename Encoding, typename CharT, std::size_t... Words>
+    static constexpr bool _compare_words(const CharT* ptr, lexy::_detail::index_sequence<Words...>)
+    {
+        // The last word might only be partially filled.
+        constexpr auto word_size = [](std::size_t word) {
+            auto remaining = LTrie.size() - word * _detail::swar_length;
+            return remaining < _detail::swar_length ? remaining : _detail::swar_length;
+        };
+
+        return ((_detail::swar_load<word_size(Words)>(ptr + Words * _detail::swar_length)
+                 == _words<Encoding>.data[Words])
+                && ...);
+    }
+
+    template <typename Encoding, typename CharT>
+    static constexpr bool _matches_at(const CharT* ptr)
+    {
+        return _compare_words<Encoding>(ptr, lexy::_detail::make_index_sequence<_word_count>{});
+    }
+
+    template <typename Encoding>
+    static LEXY_CONSTEVAL bool _can_find()
+    {
+        return !LTrie.empty() && _is_bytes<Encoding>();
+    }
+
+    // Returns the position of the first occurrence of the literal in [cur, end), or end.
+    template <typename Encoding, typename CharT>
+    static constexpr const CharT* _find(const CharT* cur, const CharT* end)
+    {
+        static_assert(_can_find<Encoding>());
+        constexpr auto size  = LTrie.size();
+        constexpr auto first = static_cast<unsigned char>(_code_unit<Encoding>(0));
+        constexpr auto last  = static_cast<unsigned char>(_code_unit<Encoding>(size - 1));
+
+        // Check a word of starting positions at once:
+        // a candidate needs to have both the first and the last code unit of the literal.
+        // Only then do we compare the entire literal.
+        while (end - cur >= std::ptrdiff_t(size - 1 + _detail::swar_length))
+        {
+            auto mask = _detail::swar_equal_mask(_detail::swar_load(cur), first)
+                        & _detail::swar_equal_mask(_detail::swar_load(cur + size - 1), last);
+            for (; mask != 0; mask &= mask - 1)
+            {
+                auto candidate = cur + _detail::swar_find_first(mask);
+                if (_matches_at<Encoding>(candidate))
+                    return candidate;
+            }
+
+            cur += _detail::swar_length;
+        }
+
+        for (; end - cur >= std::ptrdiff_t(size); ++cur)
+            if (_matches_at<Encoding>(cur))
+                return cur;
+        return end;
+    }
+
     template <typename Reader>
     static constexpr error_code match(Reader& reader)
     {
+        using encoding = typename Reader::encoding;
+        if constexpr (_is_contiguous_byte_reader<Reader> && _can_compare_words<encoding>())
+        {
+            auto begin = reader.cur();
+            if ((_can_compare_padded<Reader>()
+                 || static_cast<std::size_t>(reader._end_pos() - begin) >= LTrie.size())
+                && _matches_at<encoding>(begin))
+            {
+                reader._seek(begin + LTrie.size());
+                return error_code();
+            }
+
+            // We either have a mismatch or not enough input.
+            // Fallback to the per-character comparison to determine the position of the error.
+        }
+
         return _transition(reader, LTrie.node_sequence());
     }
+
+    static LEXY_CONSTEVAL auto first_bytes()
+    {
+        if (LTrie.empty())
+            return _detail::byte_set::all();
+
+        _detail::byte_set result;
+        _detail::insert_char(result, LTrie._transition[0]);
+        return result;
+    }
 };
 
 template <const auto& LTrie, typename Reader>
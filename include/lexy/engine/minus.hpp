@@ -58,6 +58,28 @@ struct engine_minus : lexy::engine_matcher_base
         else
             return Matcher::recover(reader, error_to_matcher(ec));
     }
+
+    static LEXY_CONSTEVAL auto first_bytes()
+    {
+        return engine_first_bytes<Matcher>;
+    }
+
+    template <typename Encoding>
+    static LEXY_CONSTEVAL auto _single_bytes()
+    {
+        _detail::byte_set result;
+        if constexpr (engine_is_char_class<Except, Encoding>)
+        {
+            // Except matches a single code unit exactly if it is in its char class.
+            constexpr auto matcher = _engine_single_bytes<Matcher, Encoding>;
+            constexpr auto except  = engine_char_class<Except, Encoding>;
+            for (auto c = 0u; c != 256u; ++c)
+                if (matcher.contains(static_cast<unsigned char>(c))
+                    && !except.contains(static_cast<unsigned char>(c)))
+                    result.insert(static_cast<unsigned char>(c));
+        }
+        return result;
+    }
 };
 } // namespace lexy
 
@@ -8,6 +8,11 @@
 #include <lexy/_detail/integer_sequence.hpp>
 #include <lexy/engine/base.hpp>
 
+#ifndef LEXY_ENGINE_TRIE_TABLE_THRESHOLD
+// Tries with more nodes are matched using a transition table instead of nested templates.
+#    define LEXY_ENGINE_TRIE_TABLE_THRESHOLD 64
+#endif
+
 namespace lexy
 {
 template <typename CharT, std::size_t NodeCount, std::size_t TransitionCount>
@@ -24,6 +29,15 @@ struct _trie
         return _node_value[0] != invalid_value;
     }
 
+    LEXY_CONSTEVAL std::size_t node_count() const
+    {
+        return NodeCount;
+    }
+    LEXY_CONSTEVAL std::size_t transition_count() const
+    {
+        return TransitionCount;
+    }
+
     LEXY_CONSTEVAL std::size_t node_value(std::size_t node) const
     {
         return _node_value[node];
@@ -67,14 +81,19 @@ LEXY_CONSTEVAL auto _make_trie(lexy::_detail::index_sequence<Idxs...>)
     constexpr auto node_count_upper_bound = (Strings::get().size() + ... + 1);
 
     // We cannot construct the `_trie` directly as we don't know how many transitions each node has.
-    // So we use this temporary representation using an adjacency matrix.
+    // So we use this temporary representation where the children of each node form a linked list.
+    // As every node except the root is the child of exactly one node, this requires linear space.
     struct builder_t
     {
-        std::size_t node_count       = 1;
-        std::size_t transition_count = 0;
+        std::size_t node_count = 1;
 
         std::size_t node_value[node_count_upper_bound] = {std::size_t(-1)};
-        CharT       node_transition[node_count_upper_bound][node_count_upper_bound] = {};
+        // The character of the transition from the parent to the node.
+        CharT       node_char[node_count_upper_bound] = {};
+        // The root node is never a child, so we use 0 to indicate that there is no child/sibling.
+        std::size_t node_first_child[node_count_upper_bound]  = {};
+        std::size_t node_last_child[node_count_upper_bound]   = {};
+        std::size_t node_next_sibling[node_count_upper_bound] = {};
 
         constexpr void insert(std::size_t value, const CharT* str, std::size_t size)
         {
@@ -84,29 +103,27 @@ LEXY_CONSTEVAL auto _make_trie(lexy::_detail::index_sequence<Idxs...>)
                 auto c = *ptr;
                 LEXY_PRECONDITION(c);
 
-                auto found = false;
-                for (auto next_node = cur_node + 1; next_node < node_count; ++next_node)
-                {
-                    if (node_transition[cur_node][next_node] == c)
-                    {
-                        // The transition from `cur_node` to `next_node` using `c` is already in
-                        // the trie. Follow it.
-                        cur_node = next_node;
-                        found    = true;
-                        break;
-                    }
-                }
+                // Check whether the transition from `cur_node` using `c` is already in the trie.
+                auto next_node = node_first_child[cur_node];
+                while (next_node != 0 && node_char[next_node] != c)
+                    next_node = node_next_sibling[next_node];
 
-                if (!found)
+                if (next_node == 0)
                 {
                     // We haven't found the transition, need to create a new node.
-                    auto next_node                       = node_count++;
-                    node_value[next_node]                = std::size_t(-1);
-                    node_transition[cur_node][next_node] = c;
-                    transition_count++;
-
-                    cur_node = next_node;
+                    next_node             = node_count++;
+                    node_value[next_node] = std::size_t(-1);
+                    node_char[next_node]  = c;
+
+                    // Append it to the children of the current node.
+                    if (node_first_child[cur_node] == 0)
+                        node_first_child[cur_node] = next_node;
+                    else
+                        node_next_sibling[node_last_child[cur_node]] = next_node;
+                    node_last_child[cur_node] = next_node;
                 }
+
+                cur_node = next_node;
             }
 
             LEXY_PRECONDITION(node_value[cur_node]
@@ -122,22 +139,23 @@ LEXY_CONSTEVAL auto _make_trie(lexy::_detail::index_sequence<Idxs...>)
     }();
 
     // Now we also now the exact number of nodes and transitions in the trie.
-    _trie<CharT, builder.node_count, builder.transition_count> result{};
+    // Every node except the root has exactly one incoming transition.
+    _trie<CharT, builder.node_count, builder.node_count - 1> result{};
 
-    // Translate the adjacency matrix representation into the actual trie representation.
+    // Translate the linked list representation into the actual trie representation.
     auto transition_idx = 0u;
     for (auto node = 0u; node != builder.node_count; ++node)
     {
         result._node_value[node] = builder.node_value[node];
 
-        for (auto next_node = node + 1; next_node != builder.node_count; ++next_node)
-            if (auto c = builder.node_transition[node][next_node])
-            {
-                // We've found a transition, add it to the shared transition array.
-                result._transition_char[transition_idx] = c;
-                result._transition_node[transition_idx] = next_node;
-                ++transition_idx;
-            }
+        for (auto next_node = builder.node_first_child[node]; next_node != 0;
+             next_node      = builder.node_next_sibling[next_node])
+        {
+            // We've found a transition, add it to the shared transition array.
+            result._transition_char[transition_idx] = builder.node_char[next_node];
+            result._transition_node[transition_idx] = next_node;
+            ++transition_idx;
+        }
 
         // The node transition end at the current transition index.
         result._node_transition_idx[node] = transition_idx;
@@ -151,6 +169,56 @@ template <typename CharT, typename... Strings>
 constexpr auto trie
     = _make_trie<CharT, Strings...>(lexy::_detail::index_sequence_for<Strings...>{});
 
+template <typename IntType, std::size_t NodeCount, std::size_t TransitionCount,
+          std::size_t DenseCount>
+struct _trie_table
+{
+    static constexpr auto invalid_node = std::size_t(-1);
+
+    // Returns the node reached from the given node by the transition, or invalid_node.
+    template <typename Encoding>
+    constexpr std::size_t next(std::size_t node, IntType cur) const
+    {
+        if constexpr (DenseCount > 0)
+        {
+            if (auto row = _node_dense[node]; row != invalid_node)
+                return _is_byte<Encoding>(cur) ? _dense[row][static_cast<unsigned char>(cur)]
+                                               : invalid_node;
+        }
+
+        // Binary search in the sorted transitions of the node.
+        auto begin = _node_transition_idx[node];
+        auto end   = _node_transition_idx[node + 1];
+        while (begin != end)
+        {
+            auto middle = begin + (end - begin) / 2;
+            if (_transition_char[middle] == cur)
+                return _transition_node[middle];
+            else if (_transition_char[middle] < cur)
+                begin = middle + 1;
+            else
+                end = middle;
+        }
+        return invalid_node;
+    }
+
+    // Arrays indexed by nodes.
+    // The node has the transitions in the range [_node_transition_idx[node],
+    // _node_transition_idx[node + 1]), sorted by character.
+    std::size_t _node_value[NodeCount];
+    std::size_t _node_transition_idx[NodeCount + 1];
+    // The row in the dense table, or invalid_node if the node doesn't have one.
+    std::size_t _node_dense[NodeCount];
+
+    // Shared array for all transitions.
+    IntType     _transition_char[TransitionCount == 0 ? 1 : TransitionCount];
+    std::size_t _transition_node[TransitionCount == 0 ? 1 : TransitionCount];
+
+    // Nodes with many transitions in a single byte encoding store the next node for every code
+    // unit instead.
+    std::size_t _dense[DenseCount == 0 ? 1 : DenseCount][DenseCount == 0 ? 1 : 256];
+};
+
 /// Matches one of the strings contained in the trie.
 template <const auto& Trie>
 struct engine_trie : engine_matcher_base, engine_parser_base
@@ -219,17 +287,248 @@ struct engine_trie : engine_matcher_base, engine_parser_base
         }
     };
 
+    // Nodes with at least that many transitions get a dense row in the table.
+    static constexpr auto _dense_threshold = std::size_t(16);
+
+    template <typename Encoding>
+    static LEXY_CONSTEVAL std::size_t _dense_count()
+    {
+        if constexpr (sizeof(typename Encoding::char_type) == 1)
+        {
+            auto result = std::size_t(0);
+            for (auto node = 0u; node != Trie.node_count(); ++node)
+                if (Trie.transition_count(node) >= _dense_threshold)
+                    ++result;
+            return result;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+
+    template <typename Encoding>
+    static LEXY_CONSTEVAL auto _make_table()
+    {
+        using table_t = _trie_table<typename Encoding::int_type, Trie.node_count(),
+                                    Trie.transition_count(), _dense_count<Encoding>()>;
+        table_t result{};
+
+        auto dense_idx = std::size_t(0);
+        for (auto node = 0u; node != Trie.node_count(); ++node)
+        {
+            result._node_value[node] = Trie.node_value(node);
+
+            // Copy the transitions of the node, keeping them sorted using insertion sort.
+            auto begin = node == 0 ? 0 : Trie._node_transition_idx[node - 1];
+            auto end   = Trie._node_transition_idx[node];
+            for (auto idx = begin; idx != end; ++idx)
+            {
+                auto c    = _char_to_int_type<Encoding>(Trie._transition_char[idx]);
+                auto next = Trie._transition_node[idx];
+
+                auto pos = idx;
+                for (; pos != begin && c < result._transition_char[pos - 1]; --pos)
+                {
+                    result._transition_char[pos] = result._transition_char[pos - 1];
+                    result._transition_node[pos] = result._transition_node[pos - 1];
+                }
+                result._transition_char[pos] = c;
+                result._transition_node[pos] = next;
+            }
+            result._node_transition_idx[node]     = begin;
+            result._node_transition_idx[node + 1] = end;
+
+            // Fill in the dense row.
+            result._node_dense[node] = table_t::invalid_node;
+            if constexpr (_dense_count<Encoding>() > 0)
+            {
+                if (end - begin >= _dense_threshold)
+                {
+                    auto& row = result._dense[dense_idx];
+                    for (auto& next : row)
+                        next = table_t::invalid_node;
+                    for (auto idx = begin; idx != end; ++idx)
+                    {
+                        auto c = result._transition_char[idx];
+                        if (_is_byte<Encoding>(c))
+                            row[static_cast<unsigned char>(c)] = result._transition_node[idx];
+                    }
+
+                    result._node_dense[node] = dense_idx++;
+                }
+            }
+        }
+
+        return result;
+    }
+
+    template <typename Encoding>
+    static constexpr auto _table = _make_table<Encoding>();
+
+    // Walks the trie iteratively using the transition table.
+    template <typename Reader>
+    static constexpr std::size_t _parse_table(Reader& reader)
+    {
+        using encoding        = typename Reader::encoding;
+        constexpr auto& table = _table<encoding>;
+
+        auto result        = Trie.invalid_value;
+        auto result_reader = reader;
+
+        auto node = std::size_t(0);
+        while (true)
+        {
+            if (table._node_value[node] != Trie.invalid_value)
+            {
+                // The current node accepts; remember it in case we don't find a longer match.
+                result        = table._node_value[node];
+                result_reader = reader;
+            }
+
+            auto next = table.template next<encoding>(node, reader.peek());
+            if (next == table.invalid_node)
+                break;
+
+            reader.bump();
+            node = next;
+        }
+
+        // If we didn't find any match, the reader remains at the position of the error.
+        if (result != Trie.invalid_value)
+            reader = LEXY_MOV(result_reader);
+        return result;
+    }
+
+    template <typename Reader>
+    static constexpr std::size_t _parse(Reader& reader)
+    {
+        if constexpr (Trie.node_count() > LEXY_ENGINE_TRIE_TABLE_THRESHOLD)
+            return _parse_table(reader);
+        else
+            // We begin in the root node of the trie.
+            return _node<0>::parse(reader);
+    }
+
+    template <typename Encoding>
+    static LEXY_CONSTEVAL bool _can_find()
+    {
+        if constexpr (sizeof(typename Encoding::char_type) != 1)
+            return false;
+        else
+        {
+            if (Trie.empty() || Trie.accepts_empty())
+                return false;
+
+            // Every character needs to be a single code unit, otherwise we can't filter by bytes.
+            using char_type = typename Encoding::char_type;
+            for (auto idx = 0u; idx != Trie.transition_count(); ++idx)
+            {
+                auto c = Trie._transition_char[idx];
+                if (Encoding::to_int_type(static_cast<char_type>(c))
+                    != _char_to_int_type<Encoding>(c))
+                    return false;
+            }
+            return true;
+        }
+    }
+
+    // The search filters positions by their first two code units, similar to Teddy:
+    // each transition of the root node is assigned one of eight buckets,
+    // and a position is only a candidate if both code units belong to the same bucket.
+    template <typename Encoding>
+    static LEXY_CONSTEVAL auto _make_filter()
+    {
+        using char_type = typename Encoding::char_type;
+        auto byte       = [](auto c) {
+            return static_cast<unsigned char>(static_cast<char_type>(c));
+        };
+
+        struct filter_t
+        {
+            unsigned char first[256];
+            unsigned char second[256];
+        } result{};
+
+        for (auto transition = 0u; transition != Trie.transition_count(0); ++transition)
+        {
+            auto bucket = static_cast<unsigned char>(1u << (transition % 8));
+            result.first[byte(Trie.transition_char(0, transition))] |= bucket;
+
+            auto node = Trie.transition_next(0, transition);
+            if (Trie.node_value(node) != Trie.invalid_value)
+            {
+                // A string of length one, so any code unit can follow.
+                for (auto& mask : result.second)
+                    mask |= bucket;
+            }
+            else
+            {
+                for (auto next = 0u; next != Trie.transition_count(node); ++next)
+                    result.second[byte(Trie.transition_char(node, next))] |= bucket;
+            }
+        }
+
+        return result;
+    }
+
+    template <typename Encoding>
+    static constexpr auto _filter = _make_filter<Encoding>();
+
+    // Whether one of the strings starts at cur.
+    template <typename Encoding, typename CharT>
+    static constexpr bool _matches_at(const CharT* cur, const CharT* end)
+    {
+        constexpr auto& table = _table<Encoding>;
+
+        auto node = std::size_t(0);
+        for (; cur != end; ++cur)
+        {
+            node = table.template next<Encoding>(node, Encoding::to_int_type(*cur));
+            if (node == table.invalid_node)
+                return false;
+            else if (table._node_value[node] != Trie.invalid_value)
+                return true;
+        }
+        return false;
+    }
+
+    // Returns the first position in [cur, end) where one of the strings starts, or end.
+    template <typename Encoding, typename CharT>
+    static constexpr const CharT* _find(const CharT* cur, const CharT* end)
+    {
+        static_assert(_can_find<Encoding>());
+        constexpr auto& filter = _filter<Encoding>;
+
+        while (true)
+        {
+            // This is done word-at-a-time if there are only few different first code units.
+            cur = _detail::find_first_of<engine_first_bytes<engine_trie>>(cur, end);
+            if (cur == end)
+                return end;
+
+            auto bucket = filter.first[static_cast<unsigned char>(cur[0])];
+            if (end - cur >= 2)
+                bucket &= filter.second[static_cast<unsigned char>(cur[1])];
+            if (bucket != 0 && _matches_at<Encoding>(cur, end))
+                return cur;
+
+            ++cur;
+        }
+
+        return end; // unreachable
+    }
+
     template <typename Reader>
     static constexpr error_code match(Reader& reader)
     {
-        // We begin in the root node of the trie.
-        return _node<0>::parse(reader) == Trie.invalid_value ? error_code::error : error_code();
+        return _parse(reader) == Trie.invalid_value ? error_code::error : error_code();
     }
 
     template <typename Reader>
     static constexpr std::size_t parse(error_code& ec, Reader& reader)
     {
-        auto result = _node<0>::parse(reader);
+        auto result = _parse(reader);
         if (result == Trie.invalid_value)
             ec = error_code::error;
         else
@@ -242,6 +541,18 @@ struct engine_trie : engine_matcher_base, engine_parser_base
     {
         return false;
     }
+
+    static LEXY_CONSTEVAL auto first_bytes()
+    {
+        if (Trie.accepts_empty())
+            return _detail::byte_set::all();
+
+        // We need to take one of the transitions of the root node.
+        _detail::byte_set result;
+        for (auto transition = 0u; transition != Trie.transition_count(0); ++transition)
+            _detail::insert_char(result, Trie.transition_char(0, transition));
+        return result;
+    }
 };
 
 template <const auto& Trie, typename Reader>
@@ -20,8 +20,13 @@ struct engine_until : engine_matcher_base
     template <typename Reader>
     static constexpr error_code match(Reader& reader)
     {
-        while (!engine_try_match<Condition>(reader))
+        while (true)
         {
+            // Everything before the next candidate is consumed anyway.
+            _engine_skip_to_candidate<Condition>(reader);
+            if (engine_try_match<Condition>(reader))
+                break;
+
             if (reader.eof())
             {
                 // This match fails but gives us an appropriate error code.
@@ -51,8 +56,12 @@ struct engine_until_eof : engine_matcher_base
     template <typename Reader>
     static constexpr error_code match(Reader& reader)
     {
-        while (!engine_try_match<Condition>(reader))
+        while (true)
         {
+            _engine_skip_to_candidate<Condition>(reader);
+            if (engine_try_match<Condition>(reader))
+                break;
+
             if (reader.eof())
                 break;
 
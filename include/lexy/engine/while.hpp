@@ -22,8 +22,17 @@ struct engine_while : engine_matcher_base
     template <typename Reader>
     static constexpr error_code match(Reader& reader)
     {
-        while (engine_try_match<Matcher>(reader))
-        {}
+        using encoding = typename Reader::encoding;
+        if constexpr (_is_contiguous_byte_reader<Reader> && engine_is_char_class<Matcher, encoding>)
+        {
+            // Every code unit is matched on its own, so we can classify the entire run at once.
+            engine_skip_while<engine_char_class<Matcher, encoding>>(reader);
+        }
+        else
+        {
+            while (engine_try_match<Matcher>(reader))
+            {}
+        }
 
         return error_code();
     }
@@ -6,6 +6,7 @@
 #define LEXY_INPUT_BASE_HPP_INCLUDED
 
 #include <lexy/_detail/config.hpp>
+#include <lexy/_detail/detect.hpp>
 #include <lexy/encoding.hpp>
 
 #if 0
@@ -43,6 +44,19 @@ public:
     /// auto end = reader.cur();
     /// ```
     iterator cur() const;
+
+    /// Optional: if `iterator` is `const char_type*`, i.e. the reader reads from a contiguous
+    /// array, it can provide the following two functions to enable bulk processing.
+    /// Returns a pointer past the last character of the input.
+    iterator _end_pos() const;
+    /// Advances the reader to `pos`, which must be in the range `[cur(), _end_pos()]`.
+    void _seek(iterator pos);
+
+    /// Optional: if the reader is contiguous, the number of code units starting at `_end_pos()`
+    /// that can be read as well; they all have all bits set.
+    /// (For ASCII and UTF-8, this is `Encoding::eof()`.)
+    /// This allows bulk processing without special handling of the end.
+    static constexpr std::size_t _padding;
 };
 
 /// An Input produces a reader.
@@ -97,6 +111,16 @@ public:
         _cur = _end;
     }
 
+    constexpr Sentinel _end_pos() const noexcept
+    {
+        return _end;
+    }
+
+    constexpr void _seek(iterator pos) noexcept
+    {
+        _cur = pos;
+    }
+
 private:
     Iterator                   _cur;
     LEXY_EMPTY_MEMBER Sentinel _end;
@@ -116,6 +140,41 @@ constexpr bool char_type_compatible_with_reader
 template <typename Reader>
 constexpr bool is_canonical_reader = std::is_same_v<typename Reader::canonical_reader, Reader>;
 
+template <typename Reader>
+using _detect_contiguous_reader = decltype(LEXY_DECLVAL(Reader&)._seek(
+    LEXY_DECLVAL(Reader&)._end_pos()));
+
+/// Whether or not the reader reads from a contiguous array of code units.
+template <typename Reader>
+constexpr bool _is_contiguous_reader
+    = std::is_same_v<typename Reader::iterator, const typename Reader::char_type*> //
+      && _detail::is_detected<_detect_contiguous_reader, Reader>;
+
+/// Whether or not the reader reads from a contiguous array of single byte code units.
+template <typename Reader>
+constexpr bool _is_contiguous_byte_reader
+    = _is_contiguous_reader<Reader> && sizeof(typename Reader::char_type) == 1;
+
+template <typename Reader>
+using _detect_validated_utf8_reader = decltype(Reader::_is_validated_utf8);
+
+/// Whether or not the reader reads UTF-8 that is known to be well-formed.
+template <typename Reader>
+constexpr bool _is_validated_utf8_reader
+    = _detail::is_detected<_detect_validated_utf8_reader, Reader>;
+
+template <typename Reader>
+using _detect_padded_reader = decltype(Reader::_padding);
+
+/// The number of code units starting at `_end_pos()` that can be read without going out of bounds.
+template <typename Reader>
+constexpr std::size_t _reader_padding = [] {
+    if constexpr (_detail::is_detected<_detect_padded_reader, Reader>)
+        return Reader::_padding;
+    else
+        return std::size_t(0);
+}();
+
 /// Creates a reader that only reads until the given end.
 template <typename Reader>
 constexpr auto partial_reader(Reader reader, typename Reader::iterator end)
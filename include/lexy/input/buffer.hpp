@@ -7,6 +7,7 @@
 
 #include <cstring>
 #include <lexy/_detail/memory_resource.hpp>
+#include <lexy/_detail/swar.hpp>
 #include <lexy/error.hpp>
 #include <lexy/input/base.hpp>
 #include <lexy/lexeme.hpp>
@@ -14,8 +15,8 @@
 namespace lexy
 {
 /// Stores the input that will be parsed.
-/// For encodings with spare code points, it can append an EOF sentinel.
-/// This allows branch-less detection of EOF.
+/// It appends a sentinel code unit, which allows detecting EOF without checking the end.
+/// For encodings with spare code points, the sentinel is EOF itself.
 template <typename Encoding       = default_encoding,
           typename MemoryResource = _detail::default_memory_resource>
 class buffer
@@ -23,6 +24,15 @@ class buffer
     static constexpr auto _has_sentinel
         = std::is_same_v<typename Encoding::char_type, typename Encoding::int_type>;
 
+    // The code unit with all bits set: EOF for encodings with spare code points,
+    // or an otherwise unlikely code unit that can also occur in the input.
+    static constexpr auto _sentinel = static_cast<typename Encoding::char_type>(-1);
+
+    // The number of sentinels appended to the input.
+    // For single byte encodings, we append a word of them, so it can always be loaded at once.
+    static constexpr std::size_t _padding
+        = sizeof(typename Encoding::char_type) == 1 ? _detail::swar_length : 1;
+
 public:
     using encoding  = Encoding;
     using char_type = typename encoding::char_type;
@@ -116,10 +126,7 @@ public:
         if (!_data)
             return;
 
-        if constexpr (_has_sentinel)
-            _resource->deallocate(_data, (_size + 1) * sizeof(char_type), alignof(char_type));
-        else
-            _resource->deallocate(_data, _size * sizeof(char_type), alignof(char_type));
+        _resource->deallocate(_data, (_size + _padding) * sizeof(char_type), alignof(char_type));
     }
 
     buffer& operator=(const buffer& other) // NOLINT: we do guard against self-assignment
@@ -167,10 +174,11 @@ public:
     //=== input ===//
     auto reader() const& noexcept
     {
-        if constexpr (_has_sentinel)
-            return _sentinel_reader(_data);
-        else
-            return _detail::range_reader<encoding, const char_type*>(_data, _data + _size);
+        if (_data)
+            return _sentinel_reader(_data, _data + _size);
+
+        // An empty buffer has no memory, so we read from static sentinels instead.
+        return _sentinel_reader(_empty_padding.data, _empty_padding.data);
     }
 
 private:
@@ -182,15 +190,33 @@ private:
         using iterator         = const char_type*;
         using canonical_reader = _sentinel_reader;
 
+        static constexpr std::size_t _padding = buffer::_padding;
+
         bool eof() const noexcept
         {
-            return *_cur == encoding::eof();
+            if constexpr (_has_sentinel)
+                return *_cur == encoding::eof();
+            else
+                return _cur == _end;
         }
 
         auto peek() const noexcept
         {
-            // The last one will be EOF.
-            return *_cur;
+            if constexpr (_has_sentinel)
+            {
+                // The last one will be EOF.
+                return *_cur;
+            }
+            else
+            {
+                // The sentinel can also occur in the input;
+                // only then do we need to check whether we're actually at the end.
+                auto c = *_cur;
+                if (c == _sentinel && _cur == _end)
+                    return encoding::eof();
+                else
+                    return encoding::to_int_type(c);
+            }
         }
 
         void bump() noexcept
@@ -203,22 +229,42 @@ private:
             return _cur;
         }
 
+        iterator _end_pos() const noexcept
+        {
+            return _end;
+        }
+
+        void _seek(iterator pos) noexcept
+        {
+            _cur = pos;
+        }
+
     private:
-        explicit _sentinel_reader(iterator begin) noexcept : _cur(begin) {}
+        explicit _sentinel_reader(iterator begin, iterator end) noexcept : _cur(begin), _end(end)
+        {}
 
         iterator _cur;
+        iterator _end;
         friend buffer;
     };
 
-    char_type* allocate(std::size_t size) const
+    struct _padding_t
     {
-        if constexpr (_has_sentinel)
-            ++size;
+        char_type data[_padding];
+    };
+    static constexpr _padding_t _empty_padding = [] {
+        _padding_t result{};
+        for (auto& c : result.data)
+            c = _sentinel;
+        return result;
+    }();
 
+    char_type* allocate(std::size_t size) const
+    {
         auto memory = static_cast<char_type*>(
-            _resource->allocate(size * sizeof(char_type), alignof(char_type)));
-        if constexpr (_has_sentinel)
-            memory[size - 1] = encoding::eof();
+            _resource->allocate((size + _padding) * sizeof(char_type), alignof(char_type)));
+        for (auto idx = size; idx != size + _padding; ++idx)
+            memory[idx] = _sentinel;
         return memory;
     }
 
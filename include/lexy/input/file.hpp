@@ -5,6 +5,8 @@
 #ifndef LEXY_INPUT_FILE_HPP_INCLUDED
 #define LEXY_INPUT_FILE_HPP_INCLUDED
 
+#include <cstdint>
+#include <lexy/_detail/chunk_buffer.hpp>
 #include <lexy/_detail/lazy_init.hpp>
 #include <lexy/_detail/std.hpp>
 #include <lexy/input/base.hpp>
@@ -48,6 +50,23 @@ file_error read_file(const char* path, file_callback cb, void* user_data);
 
 // Same as above, but reads from stdin.
 file_error read_stdin(file_callback cb, void* user_data);
+
+// Maps the entire contents of the specified file into memory, or reads it if that isn't possible.
+// On success, the memory stays valid until it is released by unmap_file().
+// On error, returns the error without modifying the out parameters.
+file_error map_file(const char* path, const char** memory, std::size_t* size);
+void       unmap_file(const char* memory, std::size_t size);
+
+// An open file: a file descriptor or a FILE*, depending on the platform.
+using file_handle = std::intptr_t;
+
+// Opens the specified file, so it can be read block by block.
+// On success, the handle stays valid until it is released by close_file().
+file_error open_file(const char* path, file_handle* handle);
+// Reads at most size bytes into the buffer and stores the number of bytes read.
+// It reads zero bytes only if the end of the file has been reached.
+file_error read_file_block(file_handle handle, char* buffer, std::size_t size, std::size_t* read);
+void       close_file(file_handle handle);
 } // namespace lexy::_detail
 
 namespace lexy
@@ -149,6 +168,319 @@ auto read_file(const char*     path,
     return read_file_result(error, LEXY_MOV(user_data.buffer));
 }
 
+/// A file that is mapped into memory and parsed directly, without copying it into a buffer.
+template <typename Encoding = default_encoding>
+class mapped_file
+{
+public:
+    using encoding  = Encoding;
+    using char_type = typename encoding::char_type;
+    static_assert(sizeof(char_type) == 1,
+                  "mapped_file requires single byte code units; use read_file() instead");
+
+    mapped_file() noexcept : _memory(nullptr), _size(0), _offset(0) {}
+
+    mapped_file(mapped_file&& other) noexcept
+    : _memory(other._memory), _size(other._size), _offset(other._offset)
+    {
+        other._memory = nullptr;
+        other._size   = 0;
+        other._offset = 0;
+    }
+
+    ~mapped_file() noexcept
+    {
+        if (_memory)
+            _detail::unmap_file(_memory, _size);
+    }
+
+    mapped_file& operator=(mapped_file&& other) noexcept
+    {
+        _detail::swap(_memory, other._memory);
+        _detail::swap(_size, other._size);
+        _detail::swap(_offset, other._offset);
+        return *this;
+    }
+
+    //=== access ===//
+    const char_type* data() const noexcept
+    {
+        return reinterpret_cast<const char_type*>(_memory + _offset);
+    }
+
+    std::size_t size() const noexcept
+    {
+        return _size - _offset;
+    }
+
+    //=== input ===//
+    auto reader() const& noexcept
+    {
+        return _detail::range_reader<encoding, const char_type*>(data(), data() + size());
+    }
+
+public:
+    // Pretend this doesn't exist.
+    // Takes ownership of memory returned by _detail::map_file(); offset skips a BOM.
+    explicit mapped_file(const char* memory, std::size_t size, std::size_t offset) noexcept
+    : _memory(memory), _size(size), _offset(offset)
+    {}
+
+private:
+    const char* _memory;
+    std::size_t _size;
+    std::size_t _offset;
+};
+
+template <typename Encoding = default_encoding>
+class map_file_result
+{
+public:
+    using encoding  = Encoding;
+    using char_type = typename encoding::char_type;
+
+    explicit operator bool() const noexcept
+    {
+        return _ec == file_error::_success;
+    }
+
+    const mapped_file<Encoding>& file() const& noexcept
+    {
+        LEXY_PRECONDITION(*this);
+        return _file;
+    }
+    mapped_file<Encoding>&& file() && noexcept
+    {
+        LEXY_PRECONDITION(*this);
+        return LEXY_MOV(_file);
+    }
+
+    file_error error() const noexcept
+    {
+        LEXY_PRECONDITION(!*this);
+        return _ec;
+    }
+
+public:
+    // Pretend this doesn't exist.
+    explicit map_file_result(file_error ec, mapped_file<Encoding>&& file) noexcept
+    : _file(LEXY_MOV(file)), _ec(ec)
+    {}
+
+private:
+    mapped_file<Encoding> _file;
+    file_error            _ec;
+};
+
+/// Maps the file at the specified path into memory, so it can be parsed without copying.
+template <typename Encoding          = default_encoding,
+          encoding_endianness Endian = encoding_endianness::bom>
+auto map_file(const char* path) -> map_file_result<Encoding>
+{
+    const char* memory = nullptr;
+    std::size_t size   = 0;
+    auto        error  = _detail::map_file(path, &memory, &size);
+
+    // Same as make_buffer_from_raw(), we just skip over a UTF-8 BOM.
+    auto offset = std::size_t(0);
+    if constexpr (std::is_same_v<Encoding, utf8_encoding> && Endian == encoding_endianness::bom)
+    {
+        auto bytes = reinterpret_cast<const unsigned char*>(memory);
+        if (size >= 3 && bytes[0] == 0xEF && bytes[1] == 0xBB && bytes[2] == 0xBF)
+            offset = 3;
+    }
+
+    return map_file_result(error, mapped_file<Encoding>(memory, size, offset));
+}
+
+/// A file that is read chunk by chunk, where each chunk ends after a delimiter.
+/// Only the current chunk is kept in memory, so a file that is a sequence of delimited records
+/// can be parsed with memory proportional to the longest record, not the entire file.
+template <typename Encoding = default_encoding>
+class chunked_file
+{
+public:
+    using encoding  = Encoding;
+    using char_type = typename encoding::char_type;
+    static_assert(sizeof(char_type) == 1,
+                  "chunked_file requires single byte code units; use read_file() instead");
+
+    chunked_file() noexcept
+    : _handle(-1), _delimiter(), _ec(file_error::_success), _eof(true), _skip_bom(false)
+    {}
+
+    chunked_file(chunked_file&& other) noexcept : chunked_file()
+    {
+        *this = LEXY_MOV(other);
+    }
+
+    ~chunked_file() noexcept
+    {
+        if (_handle != -1)
+            _detail::close_file(_handle);
+    }
+
+    chunked_file& operator=(chunked_file&& other) noexcept
+    {
+        _detail::swap(_handle, other._handle);
+        _detail::swap(_buffer, other._buffer);
+        _detail::swap(_delimiter, other._delimiter);
+        _detail::swap(_ec, other._ec);
+        _detail::swap(_eof, other._eof);
+        _detail::swap(_skip_bom, other._skip_bom);
+        return *this;
+    }
+
+    //=== chunks ===//
+    /// Discards the current chunk and reads the next one.
+    /// Returns false if there is none, either because the entire file has been read,
+    /// or because of an error.
+    /// All readers and lexemes of the previous chunk are invalidated.
+    bool next_chunk()
+    {
+        if (_ec != file_error::_success)
+            return false;
+
+        _buffer.discard_chunk();
+        while (!_eof)
+        {
+            auto memory = _buffer.write_data();
+            auto read   = std::size_t(0);
+            _ec = _detail::read_file_block(_handle, memory, _buffer.write_size(), &read);
+            if (_ec != file_error::_success)
+                return false;
+            else if (read == 0)
+            {
+                _eof = true;
+                break;
+            }
+            _buffer.commit(read);
+
+            // Same as make_buffer_from_raw(), we just skip over a UTF-8 BOM.
+            // No chunk has been returned yet, so the data starts at the beginning of the file.
+            if (_skip_bom && _buffer.size() >= 3)
+            {
+                _skip_bom  = false;
+                auto bytes = reinterpret_cast<const unsigned char*>(_buffer.data());
+                if (bytes[0] == 0xEF && bytes[1] == 0xBB && bytes[2] == 0xBF)
+                    _buffer.erase_front(3);
+            }
+
+            // The chunk ends after the last delimiter we've read so far.
+            if (_buffer.find_chunk(static_cast<char>(_delimiter)))
+            {
+                // The beginning of the file has been handed out, so a BOM can't follow anymore.
+                _skip_bom = false;
+                return true;
+            }
+        }
+
+        // The remainder of the file is the last chunk.
+        _skip_bom = false;
+        return _buffer.finish_chunk();
+    }
+
+    /// The error that occurred during next_chunk(), if any.
+    file_error error() const noexcept
+    {
+        return _ec;
+    }
+
+    //=== access ===//
+    const char_type* data() const noexcept
+    {
+        return reinterpret_cast<const char_type*>(_buffer.data());
+    }
+
+    std::size_t size() const noexcept
+    {
+        return _buffer.chunk_size();
+    }
+
+    //=== input ===//
+    auto reader() const& noexcept
+    {
+        return _detail::range_reader<encoding, const char_type*>(data(), data() + size());
+    }
+
+public:
+    // Pretend this doesn't exist.
+    // Takes ownership of a handle returned by _detail::open_file().
+    explicit chunked_file(_detail::file_handle handle, char_type delimiter, std::size_t block_size,
+                          bool skip_bom)
+    : _handle(handle), _buffer(block_size), _delimiter(delimiter), _ec(file_error::_success),
+      _eof(handle == -1), _skip_bom(skip_bom)
+    {}
+
+private:
+    _detail::file_handle  _handle;
+    _detail::chunk_buffer _buffer;
+    char_type             _delimiter;
+    file_error            _ec;
+    bool                  _eof, _skip_bom;
+};
+
+template <typename Encoding = default_encoding>
+class chunked_file_result
+{
+public:
+    using encoding  = Encoding;
+    using char_type = typename encoding::char_type;
+
+    explicit operator bool() const noexcept
+    {
+        return _ec == file_error::_success;
+    }
+
+    const chunked_file<Encoding>& file() const& noexcept
+    {
+        LEXY_PRECONDITION(*this);
+        return _file;
+    }
+    chunked_file<Encoding>&& file() && noexcept
+    {
+        LEXY_PRECONDITION(*this);
+        return LEXY_MOV(_file);
+    }
+
+    file_error error() const noexcept
+    {
+        LEXY_PRECONDITION(!*this);
+        return _ec;
+    }
+
+public:
+    // Pretend this doesn't exist.
+    explicit chunked_file_result(file_error ec, chunked_file<Encoding>&& file) noexcept
+    : _file(LEXY_MOV(file)), _ec(ec)
+    {}
+
+private:
+    chunked_file<Encoding> _file;
+    file_error             _ec;
+};
+
+/// Opens the file at the specified path, so it can be read in chunks that end after `delimiter`.
+/// It reads `block_size` bytes at a time.
+template <typename Encoding          = default_encoding,
+          encoding_endianness Endian = encoding_endianness::bom>
+auto open_chunked_file(const char* path,
+                       typename Encoding::char_type delimiter  = typename Encoding::char_type('\n'),
+                       std::size_t                  block_size = 64 * 1024)
+    -> chunked_file_result<Encoding>
+{
+    auto handle = _detail::file_handle(-1);
+    auto error  = _detail::open_file(path, &handle);
+
+    constexpr auto skip_bom
+        = std::is_same_v<Encoding, utf8_encoding> && Endian == encoding_endianness::bom;
+    if (error == file_error::_success)
+        return chunked_file_result(error,
+                                   chunked_file<Encoding>(handle, delimiter, block_size, skip_bom));
+    else
+        return chunked_file_result(error, chunked_file<Encoding>());
+}
+
 /// Reads stdin into a buffer.
 template <typename Encoding          = default_encoding,
           encoding_endianness Endian = encoding_endianness::bom,
@@ -0,0 +1,107 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef LEXY_INPUT_PUSH_INPUT_HPP_INCLUDED
+#define LEXY_INPUT_PUSH_INPUT_HPP_INCLUDED
+
+#include <lexy/_detail/chunk_buffer.hpp>
+#include <lexy/error.hpp>
+#include <lexy/input/base.hpp>
+#include <lexy/lexeme.hpp>
+
+namespace lexy
+{
+/// An input whose data is fed incrementally, e.g. as it arrives over the network.
+/// It is parsed in chunks that end after a delimiter, as soon as all their data has been fed.
+template <typename Encoding = default_encoding>
+class push_input
+{
+public:
+    using encoding  = Encoding;
+    using char_type = typename encoding::char_type;
+    static_assert(sizeof(char_type) == 1, "push_input requires single byte code units");
+
+    explicit push_input(char_type delimiter = char_type('\n'), std::size_t block_size = 4 * 1024)
+    : _buffer(block_size), _delimiter(delimiter), _finished(false)
+    {}
+
+    //=== feeding ===//
+    /// Appends the data to the input.
+    /// All readers and lexemes of the current chunk are invalidated.
+    void feed(const char_type* data, std::size_t size)
+    {
+        LEXY_PRECONDITION(!_finished);
+        _buffer.append(reinterpret_cast<const char*>(data), size);
+    }
+    template <typename CharT, typename = _require_secondary_char_type<encoding, CharT>>
+    void feed(const CharT* data, std::size_t size)
+    {
+        static_assert(sizeof(CharT) == sizeof(char_type));
+        feed(reinterpret_cast<const char_type*>(data), size);
+    }
+
+    /// Signals that no more data will be fed.
+    void finish() noexcept
+    {
+        _finished = true;
+    }
+
+    bool is_finished() const noexcept
+    {
+        return _finished;
+    }
+
+    //=== chunks ===//
+    /// Discards the current chunk and makes the next one available.
+    /// Returns false if there is none: either more data needs to be fed first,
+    /// or the input is finished and everything has been parsed.
+    /// All readers and lexemes of the previous chunk are invalidated.
+    bool next_chunk()
+    {
+        _buffer.discard_chunk();
+        if (_buffer.find_chunk(static_cast<char>(_delimiter)))
+            return true;
+        else if (_finished)
+            // The remainder is the last chunk.
+            return _buffer.finish_chunk();
+        else
+            return false;
+    }
+
+    //=== access ===//
+    const char_type* data() const noexcept
+    {
+        return reinterpret_cast<const char_type*>(_buffer.data());
+    }
+
+    std::size_t size() const noexcept
+    {
+        return _buffer.chunk_size();
+    }
+
+    //=== input ===//
+    auto reader() const& noexcept
+    {
+        return _detail::range_reader<encoding, const char_type*>(data(), data() + size());
+    }
+
+private:
+    _detail::chunk_buffer _buffer;
+    char_type             _delimiter;
+    bool                  _finished;
+};
+
+//=== convenience typedefs ===//
+template <typename Encoding = default_encoding>
+using push_input_lexeme = lexeme_for<push_input<Encoding>>;
+
+template <typename Tag, typename Encoding = default_encoding>
+using push_input_error = error_for<push_input<Encoding>, Tag>;
+
+template <typename Production, typename Encoding = default_encoding>
+using push_input_error_context = error_context<Production, push_input<Encoding>>;
+} // namespace lexy
+
+#endif // LEXY_INPUT_PUSH_INPUT_HPP_INCLUDED
+
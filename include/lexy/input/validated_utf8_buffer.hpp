@@ -0,0 +1,155 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef LEXY_INPUT_VALIDATED_UTF8_BUFFER_HPP_INCLUDED
+#define LEXY_INPUT_VALIDATED_UTF8_BUFFER_HPP_INCLUDED
+
+#include <lexy/_detail/swar.hpp>
+#include <lexy/engine/code_point.hpp>
+#include <lexy/input/base.hpp>
+#include <lexy/input/buffer.hpp>
+
+namespace lexy::_detail
+{
+// Returns a pointer to the beginning of the first ill-formed code point, or end.
+constexpr const LEXY_CHAR8_T* find_invalid_utf8(const LEXY_CHAR8_T* begin,
+                                                const LEXY_CHAR8_T* end)
+{
+    auto reader = range_reader<utf8_encoding, const LEXY_CHAR8_T*>(begin, end);
+    while (true)
+    {
+        // Skip over ASCII characters, eight at a time.
+        while (static_cast<std::size_t>(end - reader.cur()) >= swar_length
+               && (swar_load(reader.cur()) & swar_fill(0x80)) == 0)
+            reader._seek(reader.cur() + swar_length);
+
+        if (reader.eof())
+            return end;
+
+        auto pos = reader.cur();
+        if (engine_cp_utf8::match(reader) != engine_cp_utf8::error_code())
+            return pos;
+    }
+
+    return end; // unreachable
+}
+} // namespace lexy::_detail
+
+namespace lexy
+{
+/// A UTF-8 buffer that has been checked to contain well-formed UTF-8.
+/// As the input cannot contain errors, code points are decoded without any checks.
+template <typename MemoryResource = _detail::default_memory_resource>
+class validated_utf8_buffer
+{
+    using _buffer_reader = input_reader<lexy::buffer<utf8_encoding, MemoryResource>>;
+
+public:
+    using encoding  = utf8_encoding;
+    using char_type = typename encoding::char_type;
+
+    /// Takes ownership of the buffer and validates its contents.
+    explicit validated_utf8_buffer(lexy::buffer<utf8_encoding, MemoryResource>&& buffer) noexcept
+    : _buffer(LEXY_MOV(buffer)),
+      _error(_detail::find_invalid_utf8(_buffer.data(), _buffer.data() + _buffer.size()))
+    {}
+
+    /// Whether or not the buffer contains well-formed UTF-8.
+    explicit operator bool() const noexcept
+    {
+        return _error == _buffer.data() + _buffer.size();
+    }
+
+    /// The beginning of the first ill-formed code point.
+    const char_type* error_position() const noexcept
+    {
+        LEXY_PRECONDITION(!*this);
+        return _error;
+    }
+
+    const lexy::buffer<utf8_encoding, MemoryResource>& buffer() const& noexcept
+    {
+        return _buffer;
+    }
+    lexy::buffer<utf8_encoding, MemoryResource>&& buffer() && noexcept
+    {
+        return LEXY_MOV(_buffer);
+    }
+
+    //=== input ===//
+    auto reader() const& noexcept
+    {
+        LEXY_PRECONDITION(*this);
+        return _reader(_buffer.reader());
+    }
+
+private:
+    class _reader
+    {
+    public:
+        using encoding         = utf8_encoding;
+        using char_type        = typename encoding::char_type;
+        using iterator         = typename _buffer_reader::iterator;
+        using canonical_reader = _reader;
+
+        static constexpr auto        _is_validated_utf8 = true;
+        static constexpr std::size_t _padding           = lexy::_reader_padding<_buffer_reader>;
+
+        bool eof() const noexcept
+        {
+            return _impl.eof();
+        }
+
+        auto peek() const noexcept
+        {
+            return _impl.peek();
+        }
+
+        void bump() noexcept
+        {
+            _impl.bump();
+        }
+
+        iterator cur() const noexcept
+        {
+            return _impl.cur();
+        }
+
+        iterator _end_pos() const noexcept
+        {
+            return _impl._end_pos();
+        }
+
+        void _seek(iterator pos) noexcept
+        {
+            _impl._seek(pos);
+        }
+
+    private:
+        explicit _reader(_buffer_reader impl) noexcept : _impl(impl) {}
+
+        _buffer_reader _impl;
+        friend validated_utf8_buffer;
+    };
+
+    lexy::buffer<utf8_encoding, MemoryResource> _buffer;
+    const char_type*                            _error;
+};
+
+template <typename MemoryResource>
+validated_utf8_buffer(buffer<utf8_encoding, MemoryResource>&&)
+    -> validated_utf8_buffer<MemoryResource>;
+
+template <typename MemoryResource = _detail::default_memory_resource>
+using validated_utf8_buffer_lexeme = lexeme_for<validated_utf8_buffer<MemoryResource>>;
+
+template <typename Tag, typename MemoryResource = _detail::default_memory_resource>
+using validated_utf8_buffer_error = error_for<validated_utf8_buffer<MemoryResource>, Tag>;
+
+template <typename Production, typename MemoryResource = _detail::default_memory_resource>
+using validated_utf8_buffer_error_context
+    = error_context<Production, validated_utf8_buffer<MemoryResource>>;
+} // namespace lexy
+
+#endif // LEXY_INPUT_VALIDATED_UTF8_BUFFER_HPP_INCLUDED
@@ -108,6 +108,69 @@ lexy::file_error lexy::_detail::read_file(const char* path, file_callback cb, vo
     return lexy::file_error::_success;
 }
 
+lexy::file_error lexy::_detail::map_file(const char* path, const char** memory, std::size_t* size)
+{
+    raii_fd fd(::open(path, O_RDONLY));
+    if (fd < 0)
+        return get_file_error();
+
+    auto off = ::lseek(fd, 0, SEEK_END);
+    if (off == static_cast<::off_t>(-1))
+        return lexy::file_error::os_error;
+
+    if (off == 0)
+    {
+        // We can't map an empty file, but there is nothing to map anyway.
+        *memory = nullptr;
+        *size   = 0;
+        return lexy::file_error::_success;
+    }
+
+    auto result = ::mmap(nullptr, static_cast<std::size_t>(off), PROT_READ, MAP_PRIVATE, fd, 0);
+    if (result == MAP_FAILED) // NOLINT: int-to-ptr conversion happens in header
+        return lexy::file_error::os_error;
+
+    *memory = static_cast<const char*>(result);
+    *size   = static_cast<std::size_t>(off);
+    return lexy::file_error::_success;
+}
+
+void lexy::_detail::unmap_file(const char* memory, std::size_t size)
+{
+    ::munmap(const_cast<char*>(memory), size);
+}
+
+lexy::file_error lexy::_detail::open_file(const char* path, file_handle* handle)
+{
+    auto fd = ::open(path, O_RDONLY);
+    if (fd < 0)
+        return get_file_error();
+
+    *handle = fd;
+    return lexy::file_error::_success;
+}
+
+lexy::file_error lexy::_detail::read_file_block(file_handle handle, char* buffer, std::size_t size,
+                                                std::size_t* read)
+{
+    while (true)
+    {
+        auto result = ::read(static_cast<int>(handle), buffer, size);
+        if (result >= 0)
+        {
+            *read = static_cast<std::size_t>(result);
+            return lexy::file_error::_success;
+        }
+        else if (errno != EINTR)
+            return lexy::file_error::os_error;
+    }
+}
+
+void lexy::_detail::close_file(file_handle handle)
+{
+    ::close(static_cast<int>(handle));
+}
+
 #else // portable read_file() using C I/O
 
 namespace
@@ -184,6 +247,66 @@ lexy::file_error lexy::_detail::read_file(const char* path, file_callback cb, vo
     return file_error::_success;
 }
 
+lexy::file_error lexy::_detail::map_file(const char* path, const char** memory, std::size_t* size)
+{
+    // We can't map the file portably, so we read it into memory instead.
+    raii_file file(std::fopen(path, "rb"));
+    if (!file)
+        return get_file_error();
+
+    if (std::fseek(file, 0, SEEK_END) != 0)
+        return lexy::file_error::os_error;
+
+    auto file_size = std::ftell(file);
+    if (file_size == -1)
+        return lexy::file_error::os_error;
+
+    if (std::fseek(file, 0, SEEK_SET) != 0)
+        return lexy::file_error::os_error;
+
+    auto data = new char[std::size_t(file_size) + 1]; // + 1, so we never allocate zero bytes.
+    if (std::fread(data, sizeof(char), std::size_t(file_size), file) != std::size_t(file_size))
+    {
+        delete[] data;
+        return lexy::file_error::os_error;
+    }
+
+    *memory = data;
+    *size   = std::size_t(file_size);
+    return file_error::_success;
+}
+
+void lexy::_detail::unmap_file(const char* memory, std::size_t)
+{
+    delete[] memory;
+}
+
+lexy::file_error lexy::_detail::open_file(const char* path, file_handle* handle)
+{
+    auto file = std::fopen(path, "rb");
+    if (!file)
+        return get_file_error();
+
+    *handle = reinterpret_cast<file_handle>(file);
+    return file_error::_success;
+}
+
+lexy::file_error lexy::_detail::read_file_block(file_handle handle, char* buffer, std::size_t size,
+                                                std::size_t* read)
+{
+    auto file = reinterpret_cast<std::FILE*>(handle);
+
+    *read = std::fread(buffer, sizeof(char), size, file);
+    if (*read < size && std::ferror(file) != 0)
+        return lexy::file_error::os_error;
+    return file_error::_success;
+}
+
+void lexy::_detail::close_file(file_handle handle)
+{
+    std::fclose(reinterpret_cast<std::FILE*>(handle));
+}
+
 #endif
 
 // When reading from stdin, performance doesn't really matter.
@@ -0,0 +1,22 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <lexy/callback/floating_point.hpp>
+
+#include <doctest/doctest.h>
+
+TEST_CASE("as_floating_point")
+{
+    double no_sign = lexy::as_floating_point<double>(1.5);
+    CHECK(no_sign == 1.5);
+
+    double minus_sign = lexy::as_floating_point<double>(lexy::minus_sign{}, 1.5);
+    CHECK(minus_sign == -1.5);
+
+    double plus_sign = lexy::as_floating_point<double>(lexy::plus_sign{}, 1.5);
+    CHECK(plus_sign == 1.5);
+
+    float narrowed = lexy::as_floating_point<float>(0.25);
+    CHECK(narrowed == 0.25f);
+}
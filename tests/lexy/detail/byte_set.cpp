@@ -0,0 +1,163 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <lexy/_detail/byte_set.hpp>
+
+#include <cstring>
+#include <doctest/doctest.h>
+
+TEST_CASE("byte_set")
+{
+    SUBCASE("empty")
+    {
+        constexpr auto set = lexy::_detail::byte_set();
+        CHECK(set.size() == 0);
+        CHECK(!set.is_all());
+        CHECK(!set.contains('a'));
+    }
+    SUBCASE("all")
+    {
+        constexpr auto set = lexy::_detail::byte_set::all();
+        CHECK(set.size() == 256);
+        CHECK(set.is_all());
+        CHECK(set.contains('a'));
+        CHECK(set.contains(0xFF));
+    }
+    SUBCASE("insert")
+    {
+        constexpr auto set = lexy::_detail::byte_set().insert('a').insert('0', '9').insert(0xFF);
+        CHECK(set.size() == 12);
+        CHECK(set.contains('a'));
+        CHECK(!set.contains('b'));
+        CHECK(set.contains('0'));
+        CHECK(set.contains('5'));
+        CHECK(set.contains('9'));
+        CHECK(set.contains(0xFF));
+
+        CHECK(set.nth(0) == '0');
+        CHECK(set.nth(10) == 'a');
+        CHECK(set.nth(11) == 0xFF);
+
+        CHECK(set.range_count() == 3);
+        CHECK(set.nth_range(0).min == '0');
+        CHECK(set.nth_range(0).max == '9');
+        CHECK(set.nth_range(1).min == 'a');
+        CHECK(set.nth_range(1).max == 'a');
+        CHECK(set.nth_range(2).min == 0xFF);
+        CHECK(set.nth_range(2).max == 0xFF);
+    }
+}
+
+namespace
+{
+constexpr auto set_x    = lexy::_detail::byte_set().insert('x');
+constexpr auto set_xyz  = lexy::_detail::byte_set().insert('x', 'z');
+constexpr auto set_xy09 = lexy::_detail::byte_set().insert('x', 'y').insert('0', '9');
+
+constexpr auto set_alnum
+    = lexy::_detail::byte_set().insert('0', '9').insert('a', 'z').insert('A', 'Z');
+constexpr auto set_high = lexy::_detail::byte_set().insert('a', 'z').insert(0x80, 0xFF);
+
+template <const auto& Set>
+std::size_t find(const char* str)
+{
+    auto end = str + std::strlen(str);
+    return std::size_t(lexy::_detail::find_first_of<Set>(str, end) - str);
+}
+
+template <const auto& Set>
+std::size_t find_not(const char* str)
+{
+    auto end = str + std::strlen(str);
+    return std::size_t(lexy::_detail::find_first_not_of<Set>(str, end) - str);
+}
+
+// Copies the string into memory that is followed by a word of EOF padding.
+struct padded_string
+{
+    explicit padded_string(const char* str) : size(std::strlen(str))
+    {
+        std::memset(data, 0xFF, sizeof(data));
+        std::memcpy(data, str, size);
+    }
+
+    char        data[64];
+    std::size_t size;
+};
+
+template <const auto& Set>
+std::size_t find_padded(const char* str)
+{
+    padded_string padded(str);
+    auto          end = padded.data + padded.size;
+    return std::size_t(
+        lexy::_detail::find_first_of<Set, lexy::_detail::swar_length>(padded.data, end)
+        - padded.data);
+}
+
+template <const auto& Set>
+std::size_t find_not_padded(const char* str)
+{
+    padded_string padded(str);
+    auto          end = padded.data + padded.size;
+    return std::size_t(
+        lexy::_detail::find_first_not_of<Set, lexy::_detail::swar_length>(padded.data, end)
+        - padded.data);
+}
+} // namespace
+
+TEST_CASE("find_first_of")
+{
+    CHECK(find<set_x>("") == 0);
+    CHECK(find<set_x>("x") == 0);
+    CHECK(find<set_x>("abc") == 3);
+    CHECK(find<set_x>("abcx") == 3);
+    CHECK(find<set_x>("abcdefgx") == 7);
+    CHECK(find<set_x>("abcdefghx") == 8);
+    CHECK(find<set_x>("abcdefghijklmnopqrstuvw") == 23);
+    CHECK(find<set_x>("abcdefghijklmnopqrstuvwx") == 23);
+
+    CHECK(find<set_xyz>("abcdefghijklmnopz") == 16);
+    CHECK(find<set_xyz>("abcdefghijklmnopyx") == 16);
+    CHECK(find<set_xyz>("abcdefghijklmnop") == 16);
+
+    CHECK(find<set_xy09>("abcdefghijklmnop5") == 16);
+    CHECK(find<set_xy09>("abcdefghijklmnopy") == 16);
+    CHECK(find<set_xy09>("abcdefghijklmnop") == 16);
+
+    CHECK(find_padded<set_x>("") == 0);
+    CHECK(find_padded<set_x>("x") == 0);
+    CHECK(find_padded<set_x>("abc") == 3);
+    CHECK(find_padded<set_x>("abcx") == 3);
+    CHECK(find_padded<set_x>("abcdefghx") == 8);
+    CHECK(find_padded<set_x>("abcdefghijklmnopqrstuvw") == 23);
+    CHECK(find_padded<set_xy09>("abcdefghijklmnop5") == 16);
+}
+
+TEST_CASE("find_first_not_of")
+{
+    CHECK(find_not<set_x>("") == 0);
+    CHECK(find_not<set_x>("a") == 0);
+    CHECK(find_not<set_x>("xxxa") == 3);
+    CHECK(find_not<set_x>("xxxxxxxxxxxxxxxxa") == 16);
+    CHECK(find_not<set_x>("xxxxxxxxxxxxxxxx") == 16);
+
+    CHECK(find_not<set_alnum>("abcXYZ0123456789 abc") == 16);
+    CHECK(find_not<set_alnum>("abcXYZ0123456789_abc") == 16);
+    CHECK(find_not<set_alnum>("abcXYZ0123456789\xFF"
+                                 "abc") == 16);
+    CHECK(find_not<set_alnum>("abcXYZ0123456789") == 16);
+    CHECK(find_not<set_alnum>("abc@") == 3);
+
+    CHECK(find_not<set_high>("abcdefgh\x80\xFFijklmn0") == 16);
+    CHECK(find_not<set_high>("abcdefgh\x80\xFFijklmn") == 16);
+
+    CHECK(find_not_padded<set_x>("") == 0);
+    CHECK(find_not_padded<set_x>("a") == 0);
+    CHECK(find_not_padded<set_x>("xxxa") == 3);
+    CHECK(find_not_padded<set_x>("xxx") == 3);
+    CHECK(find_not_padded<set_x>("xxxxxxxxxxxxxxxx") == 16);
+    CHECK(find_not_padded<set_alnum>("abcXYZ0123456789 abc") == 16);
+    CHECK(find_not_padded<set_alnum>("abcXYZ0123") == 10);
+}
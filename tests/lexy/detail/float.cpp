@@ -0,0 +1,99 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <lexy/_detail/float.hpp>
+
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+#include <doctest/doctest.h>
+#include <string>
+
+namespace
+{
+template <typename T>
+T convert(const std::string& str)
+{
+    auto begin = str.data();
+    auto end   = str.data() + str.size();
+
+    lexy::_detail::float_decimal<const char*> decimal{};
+    decimal.integer_begin = begin;
+    decimal.integer_end   = begin;
+    while (decimal.integer_end != end && *decimal.integer_end != '.' && *decimal.integer_end != 'e')
+        ++decimal.integer_end;
+
+    decimal.fraction_begin = decimal.fraction_end = decimal.integer_end;
+    if (decimal.fraction_begin != end && *decimal.fraction_begin == '.')
+    {
+        decimal.fraction_end = ++decimal.fraction_begin;
+        while (decimal.fraction_end != end && *decimal.fraction_end != 'e')
+            ++decimal.fraction_end;
+    }
+
+    if (decimal.fraction_end != end)
+        decimal.exponent = std::stoll(std::string(decimal.fraction_end + 1, end));
+
+    return lexy::_detail::float_from_decimal<T>(decimal);
+}
+
+template <typename T>
+bool same_bits(T lhs, T rhs)
+{
+    return std::memcmp(&lhs, &rhs, sizeof(T)) == 0;
+}
+} // namespace
+
+TEST_CASE("_detail::float_from_decimal<double>")
+{
+    CHECK(same_bits(convert<double>("0"), 0.0));
+    CHECK(same_bits(convert<double>("0.000e10"), 0.0));
+    CHECK(same_bits(convert<double>("1"), 1.0));
+    CHECK(same_bits(convert<double>("0.1"), 0.1));
+    CHECK(same_bits(convert<double>("3.141592653589793"), 3.141592653589793));
+    CHECK(same_bits(convert<double>("123456789012345678901234567890"), 1.2345678901234568e29));
+    CHECK(same_bits(convert<double>("1e23"), 1e23));
+    CHECK(same_bits(convert<double>("8.589973e9"), 8.589973e9));
+    CHECK(same_bits(convert<double>("45.817"), 45.817));
+    CHECK(same_bits(convert<double>("65.5931"), 65.5931));
+
+    // Limits.
+    CHECK(same_bits(convert<double>("1.7976931348623157e308"), DBL_MAX));
+    CHECK(same_bits(convert<double>("1.7976931348623158e308"), DBL_MAX));
+    CHECK(same_bits(convert<double>("1.7976931348623159e308"), HUGE_VAL));
+    CHECK(same_bits(convert<double>("1e400"), HUGE_VAL));
+    CHECK(same_bits(convert<double>("2.2250738585072014e-308"), DBL_MIN));
+    CHECK(same_bits(convert<double>("2.2250738585072011e-308"), 2.2250738585072011e-308));
+    CHECK(same_bits(convert<double>("4.9406564584124654e-324"), 4.9406564584124654e-324));
+    CHECK(same_bits(convert<double>("2.4703282292062328e-324"), 4.9406564584124654e-324));
+    CHECK(same_bits(convert<double>("2.4703282292062327e-324"), 0.0));
+    CHECK(same_bits(convert<double>("1e-400"), 0.0));
+
+    // Halfway between 2^53 and 2^53 + 2: round to even.
+    CHECK(same_bits(convert<double>("9007199254740993"), 9007199254740992.0));
+    CHECK(same_bits(convert<double>("9007199254740993.0000000000000000000000000000001"),
+                    9007199254740994.0));
+    CHECK(same_bits(convert<double>("9007199254740995"), 9007199254740996.0));
+
+    // More digits than fit into the mantissa.
+    CHECK(same_bits(convert<double>("0." + std::string(400, '0') + "1e401"), 1.0));
+    CHECK(same_bits(convert<double>("1" + std::string(800, '0') + "e-800"), 1.0));
+    CHECK(same_bits(convert<double>("18446744073709551616"), 18446744073709551616.0));
+}
+
+TEST_CASE("_detail::float_from_decimal<float>")
+{
+    CHECK(same_bits(convert<float>("0"), 0.0f));
+    CHECK(same_bits(convert<float>("1"), 1.0f));
+    CHECK(same_bits(convert<float>("0.1"), 0.1f));
+    CHECK(same_bits(convert<float>("16777217"), 16777216.0f));
+    CHECK(same_bits(convert<float>("3.4028235e38"), FLT_MAX));
+    CHECK(same_bits(convert<float>("3.40282356e38"), FLT_MAX));
+    CHECK(same_bits(convert<float>("3.4028236e38"), HUGE_VALF));
+    CHECK(same_bits(convert<float>("3.5e38"), HUGE_VALF));
+    CHECK(same_bits(convert<float>("1.17549435e-38"), FLT_MIN));
+    CHECK(same_bits(convert<float>("1.4e-45"), 1.4e-45f));
+    CHECK(same_bits(convert<float>("7.006492321624085e-46"), 0.0f));
+    CHECK(same_bits(convert<float>("7.006492321624086e-46"), 1.4e-45f));
+}
@@ -0,0 +1,93 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <lexy/_detail/swar.hpp>
+#include <type_traits>
+
+#include <doctest/doctest.h>
+
+TEST_CASE("swar_load")
+{
+    constexpr auto word = lexy::_detail::swar_load("abcdefgh");
+    CHECK((word & 0xFF) == 'a');
+    CHECK((word >> 56) == 'h');
+
+    constexpr auto partial = lexy::_detail::swar_load<3>("abcdefgh");
+    CHECK(partial == (lexy::_detail::swar_int('c') << 16 | 'b' << 8 | 'a'));
+}
+
+TEST_CASE("swar_char_mask")
+{
+    auto find = [](const char* str, char c) {
+        auto mask = lexy::_detail::swar_char_mask(lexy::_detail::swar_load(str),
+                                                  static_cast<unsigned char>(c));
+        return mask == 0 ? std::size_t(8) : lexy::_detail::swar_find_first(mask);
+    };
+
+    CHECK(find("abcdefgh", 'a') == 0);
+    CHECK(find("abcdefgh", 'd') == 3);
+    CHECK(find("abcdefgh", 'h') == 7);
+    CHECK(find("abcdefgh", 'x') == 8);
+    CHECK(find("xbcxefgx", 'x') == 0);
+    CHECK(find("a\x01\x01\x01\x01\x01\x01\x01", '\x00') == 8);
+    CHECK(find("\x01\x00\x01\x00\x01\x00\x01\x00", '\x00') == 1);
+}
+
+TEST_CASE("swar_equal_mask")
+{
+    auto mask = [](const char* str, char c) {
+        return lexy::_detail::swar_equal_mask(lexy::_detail::swar_load(str),
+                                              static_cast<unsigned char>(c));
+    };
+
+    CHECK(mask("abcdefgh", 'a') == 0x80);
+    CHECK(mask("abcdefgh", 'x') == 0);
+    CHECK(mask("xbcxefgx", 'x') == 0x8000'0000'8000'0080);
+    CHECK(mask("\x80\xFF\x7F\xFF\x01\xFF\x00\xFF", '\xFF') == 0x8000'8000'8000'8000);
+
+    // Unlike swar_char_mask(), bytes after a match are exact as well.
+    CHECK(mask("\x00\x01\x00\x01\x00\x01\x00\x01", '\x00') == 0x0080'0080'0080'0080);
+}
+
+TEST_CASE("swar_range_mask")
+{
+    auto find = [](const char* str, char min, char max) {
+        auto mask = lexy::_detail::swar_range_mask(lexy::_detail::swar_load(str),
+                                                   static_cast<unsigned char>(min),
+                                                   static_cast<unsigned char>(max));
+        return mask == 0 ? std::size_t(8) : lexy::_detail::swar_find_first(mask);
+    };
+
+    CHECK(find("abcdefgh", 'a', 'z') == 0);
+    CHECK(find("abcdefgh", 'd', 'f') == 3);
+    CHECK(find("abcdefgh", 'h', 'h') == 7);
+    CHECK(find("abcdefgh", '0', '9') == 8);
+    CHECK(find("\x80\xFF\xE1\x01\x01\x01\x01\x01", '\x00', '\x7F') == 3);
+    CHECK(find("\x80\xFF\xE1\x7F\x01\x01\x01\x01", '\x7F', '\x7F') == 3);
+
+    // The mask is exact for every byte.
+    auto mask = lexy::_detail::swar_range_mask(lexy::_detail::swar_load("a0b1c2d3"), '0', '9');
+    CHECK(mask == 0x8000'8000'8000'8000);
+}
+
+TEST_CASE("swar_parse_digits")
+{
+    auto parse = [](auto radix, const char* str) {
+        return lexy::_detail::swar_parse_digits<decltype(radix)::value>(
+            lexy::_detail::swar_load(str));
+    };
+    using dec = std::integral_constant<unsigned, 10>;
+    using hex = std::integral_constant<unsigned, 16>;
+
+    CHECK(parse(dec{}, "00000000") == 0);
+    CHECK(parse(dec{}, "12345678") == 12345678);
+    CHECK(parse(dec{}, "00000042") == 42);
+    CHECK(parse(dec{}, "99999999") == 99999999);
+
+    CHECK(parse(hex{}, "00000000") == 0);
+    CHECK(parse(hex{}, "12345678") == 0x12345678);
+    CHECK(parse(hex{}, "89abcdef") == 0x89abcdef);
+    CHECK(parse(hex{}, "89ABCDEF") == 0x89abcdef);
+    CHECK(parse(hex{}, "ffffffff") == 0xffffffff);
+}
@@ -7,6 +7,7 @@
 #include "verify.hpp"
 #include <lexy/dsl/error.hpp>
 #include <lexy/dsl/if.hpp>
+#include <lexy/dsl/peek.hpp>
 
 TEST_CASE("dsl::operator|")
 {
@@ -146,6 +147,127 @@ TEST_CASE("dsl::operator|")
         auto def = LEXY_VERIFY("def");
         CHECK(def == 1);
     }
+    SUBCASE("literals")
+    {
+        static constexpr auto rule = LEXY_LIT("abc") >> label<0> | LEXY_LIT("ab") >> label<1>
+                                     | LEXY_LIT("a") >> label<2> | LEXY_LIT("abcd") >> label<3>
+                                     | LEXY_LIT("b") >> label<4>;
+        CHECK(lexy::is_rule<decltype(rule)>);
+
+        struct callback
+        {
+            const char* str;
+
+            LEXY_VERIFY_FN int success(const char*, id<0>)
+            {
+                return 0;
+            }
+            LEXY_VERIFY_FN int success(const char*, id<1>)
+            {
+                return 1;
+            }
+            LEXY_VERIFY_FN int success(const char*, id<2>)
+            {
+                return 2;
+            }
+            LEXY_VERIFY_FN int success(const char*, id<3>)
+            {
+                return 3;
+            }
+            LEXY_VERIFY_FN int success(const char*, id<4>)
+            {
+                return 4;
+            }
+
+            LEXY_VERIFY_FN int error(test_error<lexy::exhausted_choice> e)
+            {
+                LEXY_VERIFY_CHECK(e.position() == str);
+                return -1;
+            }
+        };
+
+        auto empty = LEXY_VERIFY("");
+        CHECK(empty == -1);
+
+        auto abcd = LEXY_VERIFY("abcd");
+        CHECK(abcd == 0);
+        auto abd = LEXY_VERIFY("abd");
+        CHECK(abd == 1);
+        auto a = LEXY_VERIFY("a");
+        CHECK(a == 2);
+        auto b = LEXY_VERIFY("b");
+        CHECK(b == 4);
+        auto c = LEXY_VERIFY("c");
+        CHECK(c == -1);
+    }
+    SUBCASE("many branches")
+    {
+        static constexpr auto rule
+            = LEXY_LIT("a") >> label<0> | LEXY_LIT("b") | LEXY_LIT("c")
+              | (LEXY_LIT("d") >> label<1> | LEXY_LIT("ab"))
+              | lexy::dsl::peek(LEXY_LIT("e")) >> label<2> | LEXY_LIT("e") | LEXY_LIT("f")
+              | LEXY_LIT("gh") >> label<3> | LEXY_LIT("g") >> label<4>;
+        CHECK(lexy::is_rule<decltype(rule)>);
+
+        struct callback
+        {
+            const char* str;
+
+            LEXY_VERIFY_FN int success(const char*)
+            {
+                return 100;
+            }
+            LEXY_VERIFY_FN int success(const char*, id<0>)
+            {
+                return 0;
+            }
+            LEXY_VERIFY_FN int success(const char*, id<1>)
+            {
+                return 1;
+            }
+            LEXY_VERIFY_FN int success(const char*, id<2>)
+            {
+                return 2;
+            }
+            LEXY_VERIFY_FN int success(const char*, id<3>)
+            {
+                return 3;
+            }
+            LEXY_VERIFY_FN int success(const char*, id<4>)
+            {
+                return 4;
+            }
+
+            LEXY_VERIFY_FN int error(test_error<lexy::exhausted_choice> e)
+            {
+                LEXY_VERIFY_CHECK(e.position() == str);
+                return -1;
+            }
+        };
+
+        auto empty = LEXY_VERIFY("");
+        CHECK(empty == -1);
+
+        auto a = LEXY_VERIFY("a");
+        CHECK(a == 0);
+        auto ab = LEXY_VERIFY("ab");
+        CHECK(ab == 0);
+        auto c = LEXY_VERIFY("c");
+        CHECK(c == 100);
+        auto d = LEXY_VERIFY("d");
+        CHECK(d == 1);
+        auto g = LEXY_VERIFY("g");
+        CHECK(g == 4);
+        auto gh = LEXY_VERIFY("gh");
+        CHECK(gh == 3);
+
+        // We don't know the first code units of dsl::peek(), but it still has priority.
+        auto e = LEXY_VERIFY("e");
+        CHECK(e == 2);
+
+        auto z = LEXY_VERIFY("z");
+        CHECK(z == -1);
+    }
 
     SUBCASE("as branch")
     {
@@ -262,6 +262,68 @@ TEST_CASE("dsl::delimited()")
         auto inner_whitespace = LEXY_VERIFY_PRODUCTION(ws_production, "(  abc)");
         CHECK(inner_whitespace == 5);
     }
+    SUBCASE("runs")
+    {
+        static constexpr auto rule = delimited(LEXY_LIT("("), LEXY_LIT(")"))(cp);
+        CHECK(lexy::is_rule<decltype(rule)>);
+
+        struct callback
+        {
+            const char* str;
+
+            LEXY_VERIFY_FN auto list()
+            {
+                struct b
+                {
+                    int runs = 0, count = 0;
+
+                    using return_type = int;
+
+                    LEXY_VERIFY_FN void operator()(lexy::lexeme_for<test_input> lex)
+                    {
+                        ++runs;
+                        count += int(lex.size());
+                    }
+
+                    LEXY_VERIFY_FN int finish() &&
+                    {
+                        return runs * 100 + count;
+                    }
+                };
+                return b{};
+            }
+            LEXY_VERIFY_FN int success(const char*, int result)
+            {
+                return result;
+            }
+
+            LEXY_VERIFY_FN int error(test_error<lexy::expected_literal>)
+            {
+                return -1;
+            }
+            LEXY_VERIFY_FN int error(test_error<lexy::missing_delimiter>)
+            {
+                return -2;
+            }
+            LEXY_VERIFY_FN int error(test_error<lexy::expected_char_class>)
+            {
+                return -3;
+            }
+        };
+
+        auto one = LEXY_VERIFY("(a)");
+        CHECK(one == 101);
+        auto long_run = LEXY_VERIFY("(abcdefghijklmnopqrstuvwxyz)");
+        CHECK(long_run == 126);
+
+        auto unterminated = LEXY_VERIFY("(abcdefghijklmnopqrstuvwxyz");
+        CHECK(unterminated == -2);
+
+        auto invalid_ascii = LEXY_VERIFY("(abcdefghij\xF0"
+                                         "klmnopqrstuvwxyz)");
+        CHECK(invalid_ascii.value == 226);
+        CHECK(invalid_ascii.errors(-3));
+    }
 }
 
 TEST_CASE("dsl::delimited with escape")
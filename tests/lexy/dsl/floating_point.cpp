@@ -0,0 +1,138 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <lexy/dsl/floating_point.hpp>
+
+#include "verify.hpp"
+#include <lexy/dsl/sign.hpp>
+
+TEST_CASE("dsl::floating_point")
+{
+    SUBCASE("double")
+    {
+        static constexpr auto rule = lexy::dsl::floating_point<double>;
+        CHECK(lexy::is_rule<decltype(rule)>);
+        CHECK(lexy::is_branch_rule<decltype(rule)>);
+
+        struct callback
+        {
+            const char* str;
+
+            // All values are exactly representable multiples of 1/8.
+            LEXY_VERIFY_FN int success(const char*, double value)
+            {
+                return int(value * 8);
+            }
+
+            LEXY_VERIFY_FN int error(test_error<lexy::expected_char_class> e)
+            {
+                LEXY_VERIFY_CHECK(e.character_class()
+                                  == lexy::_detail::string_view("digit.decimal"));
+                return -1;
+            }
+        };
+
+        auto empty = LEXY_VERIFY("");
+        CHECK(empty == -1);
+        auto period = LEXY_VERIFY(".5");
+        CHECK(period == -1);
+
+        auto integer = LEXY_VERIFY("42");
+        CHECK(integer == 42 * 8);
+        auto zero = LEXY_VERIFY("0");
+        CHECK(zero == 0);
+        auto leading_zeroes = LEXY_VERIFY("0042");
+        CHECK(leading_zeroes == 42 * 8);
+
+        auto fraction = LEXY_VERIFY("1.5");
+        CHECK(fraction == 12);
+        auto small_fraction = LEXY_VERIFY("0.125");
+        CHECK(small_fraction == 1);
+        auto trailing_zeroes = LEXY_VERIFY("2.50000000000000000000000000");
+        CHECK(trailing_zeroes == 20);
+        auto missing_fraction = LEXY_VERIFY("1.");
+        CHECK(missing_fraction == -1);
+
+        auto exponent = LEXY_VERIFY("1e2");
+        CHECK(exponent == 800);
+        auto exponent_upper = LEXY_VERIFY("1E2");
+        CHECK(exponent_upper == 800);
+        auto exponent_plus = LEXY_VERIFY("1e+2");
+        CHECK(exponent_plus == 800);
+        auto exponent_minus = LEXY_VERIFY("1250e-4");
+        CHECK(exponent_minus == 1);
+        auto exponent_fraction = LEXY_VERIFY("0.0125e1");
+        CHECK(exponent_fraction == 1);
+        auto missing_exponent = LEXY_VERIFY("1e");
+        CHECK(missing_exponent == -1);
+        auto missing_exponent_sign = LEXY_VERIFY("1e-");
+        CHECK(missing_exponent_sign == -1);
+
+        auto tiny = LEXY_VERIFY("1e-400");
+        CHECK(tiny == 0);
+        auto huge_exponent = LEXY_VERIFY("0e99999999999999999999");
+        CHECK(huge_exponent == 0);
+
+        auto trailing = LEXY_VERIFY("1.5.5");
+        CHECK(trailing == 12);
+        auto trailing_exponent = LEXY_VERIFY("1.5f2");
+        CHECK(trailing_exponent == 12);
+    }
+    SUBCASE("float")
+    {
+        static constexpr auto rule = lexy::dsl::floating_point<float>;
+        CHECK(lexy::is_rule<decltype(rule)>);
+
+        struct callback
+        {
+            const char* str;
+
+            LEXY_VERIFY_FN int success(const char*, float value)
+            {
+                return int(value * 8);
+            }
+
+            LEXY_VERIFY_FN int error(test_error<lexy::expected_char_class>)
+            {
+                return -1;
+            }
+        };
+
+        auto fraction = LEXY_VERIFY("1.5");
+        CHECK(fraction == 12);
+        auto exponent = LEXY_VERIFY("1250e-4");
+        CHECK(exponent == 1);
+        auto underflow = LEXY_VERIFY("1e-46");
+        CHECK(underflow == 0);
+    }
+    SUBCASE("sign")
+    {
+        static constexpr auto rule = lexy::dsl::minus_sign + lexy::dsl::floating_point<double>;
+
+        struct callback
+        {
+            const char* str;
+
+            LEXY_VERIFY_FN int success(const char*, double value)
+            {
+                return int(value * 8);
+            }
+            LEXY_VERIFY_FN int success(const char*, lexy::minus_sign, double value)
+            {
+                return -int(value * 8) - 1000;
+            }
+
+            LEXY_VERIFY_FN int error(test_error<lexy::expected_char_class>)
+            {
+                return -1;
+            }
+        };
+
+        auto plus = LEXY_VERIFY("1.5");
+        CHECK(plus == 12);
+        auto minus = LEXY_VERIFY("-1.5");
+        CHECK(minus.value == -1012);
+        CHECK(minus.errors());
+    }
+}
@@ -324,6 +324,69 @@ TEST_CASE("dsl::identifier()")
         auto a1 = LEXY_VERIFY("a1");
         CHECK(a1 == 1);
     }
+    SUBCASE("mixed reserve")
+    {
+        static constexpr auto rule = identifier(lexy::dsl::ascii::alpha)
+                                         .reserve(LEXY_LIT("if"), LEXY_LIT("else"))
+                                         .reserve_prefix(LEXY_LIT("xx"))
+                                         .reserve(LEXY_LIT("while"))
+                                         .reserve_containing(LEXY_LIT("q"));
+        CHECK(lexy::is_rule<decltype(rule)>);
+
+        struct callback
+        {
+            const char* str;
+
+            LEXY_VERIFY_FN int success(const char* cur, lexy::lexeme_for<test_input> id)
+            {
+                LEXY_VERIFY_CHECK(id.begin() == str);
+                LEXY_VERIFY_CHECK(id.end() == cur);
+                return int(cur - str);
+            }
+
+            LEXY_VERIFY_FN int error(test_error<lexy::expected_char_class> e)
+            {
+                LEXY_VERIFY_CHECK(e.position() == str);
+                return -1;
+            }
+            LEXY_VERIFY_FN int error(test_error<lexy::reserved_identifier> e)
+            {
+                LEXY_VERIFY_CHECK(e.begin() == str);
+                LEXY_VERIFY_CHECK(e.end() == lexy::_detail::string_view(str).end());
+                return -2;
+            }
+        };
+
+        auto empty = LEXY_VERIFY("");
+        CHECK(empty == -1);
+
+        auto i = LEXY_VERIFY("i");
+        CHECK(i == 1);
+        auto iff = LEXY_VERIFY("iff");
+        CHECK(iff == 3);
+        auto els = LEXY_VERIFY("els");
+        CHECK(els == 3);
+        auto elsewhere = LEXY_VERIFY("elsewhere");
+        CHECK(elsewhere == 9);
+        auto x = LEXY_VERIFY("x");
+        CHECK(x == 1);
+
+        auto if_ = LEXY_VERIFY("if");
+        CHECK(if_.value == 2);
+        CHECK(if_.errors(-2));
+        auto else_ = LEXY_VERIFY("else");
+        CHECK(else_.value == 4);
+        CHECK(else_.errors(-2));
+        auto while_ = LEXY_VERIFY("while");
+        CHECK(while_.value == 5);
+        CHECK(while_.errors(-2));
+        auto xxa = LEXY_VERIFY("xxa");
+        CHECK(xxa.value == 3);
+        CHECK(xxa.errors(-2));
+        auto aqa = LEXY_VERIFY("aqa");
+        CHECK(aqa.value == 3);
+        CHECK(aqa.errors(-2));
+    }
 
     SUBCASE("branch")
     {
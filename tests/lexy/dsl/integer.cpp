@@ -212,6 +212,30 @@ TEST_CASE("dsl::integer conversion")
         CHECK(parse(rule, "1'2'3'4'5") == 12345);
         CHECK(parse(rule, "0'0'0'0'0'0'1'2'3'4'5") == 12345);
     }
+    SUBCASE("base 10, uint64_t")
+    {
+        // The callback only handles int, so we test the parser directly.
+        auto parse_u64 = [](const char* str) {
+            using parser = lexyd::_integer_parser<std::uint64_t, lexy::dsl::decimal, false>;
+
+            auto result = std::uint64_t(0);
+            auto end    = str + std::char_traits<char>::length(str);
+            return parser::parse(result, str, end) ? result : std::uint64_t(-1) - 1;
+        };
+
+        CHECK(parse_u64("12345678") == 12345678u);
+        CHECK(parse_u64("123456789") == 123456789u);
+        CHECK(parse_u64("1234567890123456") == 1234567890123456u);
+        CHECK(parse_u64("98765432109876543") == 98765432109876543u);
+        CHECK(parse_u64("0000000098765432109876543") == 98765432109876543u);
+        CHECK(parse_u64("18446744073709551615") == UINT64_MAX);
+        CHECK(parse_u64("18446744073709551616") == UINT64_MAX - 1);
+        CHECK(parse_u64("99999999999999999999") == UINT64_MAX - 1);
+
+        // Separators inside a block of digits.
+        CHECK(parse_u64("1234'5678'9012'3456") == 1234567890123456u);
+        CHECK(parse_u64("1'8446744073709551615") == UINT64_MAX);
+    }
     SUBCASE("base 10, unbounded")
     {
         static constexpr auto rule = lexy::dsl::integer<lexy::unbounded<std::uint8_t>>(
@@ -268,6 +292,26 @@ TEST_CASE("dsl::integer conversion")
         CHECK(parse(rule, "0'0'F'F") == 255);
     }
 
+    SUBCASE("base 16, uint64_t")
+    {
+        auto parse_u64 = [](auto base, const char* str) {
+            using parser = lexyd::_integer_parser<std::uint64_t, decltype(base), false>;
+
+            auto result = std::uint64_t(0);
+            auto end    = str + std::char_traits<char>::length(str);
+            return parser::parse(result, str, end) ? result : std::uint64_t(-1) - 1;
+        };
+
+        CHECK(parse_u64(lexy::dsl::hex{}, "123456789abcdef0") == 0x123456789abcdef0u);
+        CHECK(parse_u64(lexy::dsl::hex{}, "123456789ABCDEF0") == 0x123456789abcdef0u);
+        CHECK(parse_u64(lexy::dsl::hex{}, "123456789aBcDeF0") == 0x123456789abcdef0u);
+        CHECK(parse_u64(lexy::dsl::hex{}, "FFFFFFFFFFFFFFFF") == UINT64_MAX);
+        CHECK(parse_u64(lexy::dsl::hex{}, "00000000FFFFFFFFFFFFFFFF") == UINT64_MAX);
+        CHECK(parse_u64(lexy::dsl::hex{}, "10000000000000000") == UINT64_MAX - 1);
+        CHECK(parse_u64(lexy::dsl::hex_lower{}, "fedcba9876543210") == 0xfedcba9876543210u);
+        CHECK(parse_u64(lexy::dsl::hex_upper{}, "FEDCBA9876543210") == 0xfedcba9876543210u);
+    }
+
     SUBCASE("generic rule")
     {
         static constexpr auto rule = lexy::dsl::integer<std::uint8_t, lexy::dsl::decimal>(
@@ -596,6 +640,47 @@ TEST_CASE("dsl::integer parsing")
         CHECK(no_digit.value == 0);
         CHECK(no_digit.errors(-2));
     }
+    SUBCASE("n_digits hex")
+    {
+        static constexpr auto rule
+            = lexy::dsl::integer<int, lexy::dsl::hex>(lexy::dsl::n_digits<4, lexy::dsl::hex>);
+
+        struct callback
+        {
+            const char* str;
+
+            LEXY_VERIFY_FN int success(const char* cur, int value)
+            {
+                LEXY_VERIFY_CHECK(cur - str <= 4);
+                return value;
+            }
+
+            LEXY_VERIFY_FN int error(test_error<lexy::integer_overflow>)
+            {
+                return -1;
+            }
+            LEXY_VERIFY_FN int error(test_error<lexy::expected_char_class>)
+            {
+                return -2;
+            }
+        };
+
+        auto zero = LEXY_VERIFY("0000");
+        CHECK(zero == 0);
+        auto lower = LEXY_VERIFY("00e9");
+        CHECK(lower == 0xE9);
+        auto upper = LEXY_VERIFY("20AC");
+        CHECK(upper == 0x20AC);
+        auto max = LEXY_VERIFY("fFfF");
+        CHECK(max == 0xFFFF);
+        auto five_digits = LEXY_VERIFY("12345");
+        CHECK(five_digits == 0x1234);
+
+        auto three_digits = LEXY_VERIFY("123");
+        CHECK(three_digits.errors(-2));
+        auto no_digit = LEXY_VERIFY("12g4");
+        CHECK(no_digit.errors(-2));
+    }
     SUBCASE("n_digits separator")
     {
         static constexpr auto rule
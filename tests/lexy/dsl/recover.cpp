@@ -49,6 +49,36 @@ TEST_CASE("dsl::find")
         auto missing = LEXY_VERIFY("abc");
         CHECK(!missing.recovered);
     }
+    SUBCASE("literals")
+    {
+        static constexpr auto rule
+            = lexy::dsl::find(LEXY_LIT("if"), LEXY_LIT("else"), LEXY_LIT("while"), LEXY_LIT(";"),
+                              LEXY_LIT("for"), LEXY_LIT("return"));
+        CHECK(lexy::is_rule<decltype(rule)>);
+
+        struct callback
+        {
+            const char* str;
+
+            LEXY_VERIFY_FN int success(const char* cur)
+            {
+                return int(cur - str);
+            }
+        };
+
+        auto empty = LEXY_VERIFY("");
+        CHECK(!empty.recovered);
+
+        auto zero = LEXY_VERIFY("while");
+        CHECK(zero == 0);
+        auto partial = LEXY_VERIFY("whil elsi retur fo i for");
+        CHECK(partial == 21);
+        auto single = LEXY_VERIFY("abcdefghijklmnopqrstuvwxyz;");
+        CHECK(single == 26);
+
+        auto missing = LEXY_VERIFY("abcdefghijklmnopqrstuvwxyz");
+        CHECK(!missing.recovered);
+    }
     SUBCASE("limit")
     {
         static constexpr auto rule
@@ -51,6 +51,44 @@ TEST_CASE("dsl::operator+")
         auto abc = LEXY_VERIFY("abc");
         CHECK(abc == 0);
     }
+    SUBCASE("literals")
+    {
+        static constexpr auto rule
+            = LEXY_LIT("ab") + LEXY_LIT("cd") + LEXY_LIT("e") + capture(LEXY_LIT("f"));
+        CHECK(lexy::is_rule<decltype(rule)>);
+
+        struct callback
+        {
+            const char* str;
+
+            LEXY_VERIFY_FN int success(const char* cur, lexy::lexeme_for<test_input> lex)
+            {
+                LEXY_VERIFY_CHECK(str + 6 == cur);
+                LEXY_VERIFY_CHECK(lex.begin() == str + 5);
+                return 0;
+            }
+
+            LEXY_VERIFY_FN int error(test_error<lexy::expected_literal> e)
+            {
+                LEXY_VERIFY_CHECK(e.position() == str + int(e.character() - 'a') - int(e.index()));
+                return -1 - int(e.character() - 'a');
+            }
+        };
+
+        auto empty = LEXY_VERIFY("");
+        CHECK(empty == -1);
+        auto abc = LEXY_VERIFY("abc");
+        CHECK(abc == -4);
+        auto abcx = LEXY_VERIFY("abcx");
+        CHECK(abcx == -4);
+        auto abcd = LEXY_VERIFY("abcd");
+        CHECK(abcd == -5);
+        auto abcde = LEXY_VERIFY("abcde");
+        CHECK(abcde == -6);
+
+        auto abcdef = LEXY_VERIFY("abcdef");
+        CHECK(abcdef == 0);
+    }
     SUBCASE("branch")
     {
         static constexpr auto rule = if_(LEXY_LIT("a") + LEXY_LIT("b") + LEXY_LIT("c"));
@@ -0,0 +1,360 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#define LEXY_IGNORE_DEPRECATED_SWITCH
+#include <lexy/dsl/switch.hpp>
+
+#include "verify.hpp"
+#include <lexy/dsl/ascii.hpp>
+#include <lexy/dsl/loop.hpp>
+#include <lexy/dsl/token.hpp>
+
+TEST_CASE("dsl::switch_()")
+{
+    static constexpr auto word = lexy::dsl::while_one(lexy::dsl::ascii::alpha);
+
+    SUBCASE("literals only")
+    {
+        static constexpr auto rule = lexy::dsl::switch_(word)
+                                         .case_(LEXY_LIT("a") >> label<0>)
+                                         .case_(LEXY_LIT("ab") >> label<1>)
+                                         .case_(LEXY_LIT("abc") >> label<2>)
+                                         .case_(LEXY_LIT("b") >> label<3>);
+        CHECK(lexy::is_rule<decltype(rule)>);
+
+        struct callback
+        {
+            const char* str;
+
+            LEXY_VERIFY_FN int success(const char*, id<0>)
+            {
+                return 0;
+            }
+
+            LEXY_VERIFY_FN int success(const char*, id<1>)
+            {
+                return 1;
+            }
+
+            LEXY_VERIFY_FN int success(const char*, id<2>)
+            {
+                return 2;
+            }
+
+            LEXY_VERIFY_FN int success(const char*, id<3>)
+            {
+                return 3;
+            }
+
+            LEXY_VERIFY_FN int error(test_error<lexy::exhausted_switch> e)
+            {
+                LEXY_VERIFY_CHECK(e.begin() == str);
+                return -1;
+            }
+
+            LEXY_VERIFY_FN int error(test_error<lexy::expected_char_class> e)
+            {
+                LEXY_VERIFY_CHECK(e.position() == str);
+                return -2;
+            }
+        };
+
+        auto empty = LEXY_VERIFY("");
+        CHECK(empty == -2);
+
+        auto a = LEXY_VERIFY("a");
+        CHECK(a == 0);
+        auto ab = LEXY_VERIFY("ab");
+        CHECK(ab == 1);
+        auto abc = LEXY_VERIFY("abc");
+        CHECK(abc == 2);
+        auto b = LEXY_VERIFY("b");
+        CHECK(b == 3);
+
+        auto abc_digit = LEXY_VERIFY("abc1");
+        CHECK(abc_digit == 2);
+
+        auto abcd = LEXY_VERIFY("abcd");
+        CHECK(abcd == -1);
+        auto c = LEXY_VERIFY("c");
+        CHECK(c == -1);
+    }
+    SUBCASE("mixed")
+    {
+        static constexpr auto rule
+            = lexy::dsl::switch_(word)
+                  .case_(LEXY_LIT("a") >> label<0>)
+                  .case_(LEXY_LIT("ab") >> label<1>)
+                  .case_(token(while_one(lexy::dsl::lit_c<'b'>)) >> label<2>)
+                  .case_(LEXY_LIT("c") >> label<3>);
+        CHECK(lexy::is_rule<decltype(rule)>);
+
+        struct callback
+        {
+            const char* str;
+
+            LEXY_VERIFY_FN int success(const char*, id<0>)
+            {
+                return 0;
+            }
+
+            LEXY_VERIFY_FN int success(const char*, id<1>)
+            {
+                return 1;
+            }
+
+            LEXY_VERIFY_FN int success(const char*, id<2>)
+            {
+                return 2;
+            }
+
+            LEXY_VERIFY_FN int success(const char*, id<3>)
+            {
+                return 3;
+            }
+
+            LEXY_VERIFY_FN int error(test_error<lexy::exhausted_switch> e)
+            {
+                LEXY_VERIFY_CHECK(e.begin() == str);
+                return -1;
+            }
+
+            LEXY_VERIFY_FN int error(test_error<lexy::expected_char_class> e)
+            {
+                LEXY_VERIFY_CHECK(e.position() == str);
+                return -2;
+            }
+        };
+
+        auto empty = LEXY_VERIFY("");
+        CHECK(empty == -2);
+
+        auto a = LEXY_VERIFY("a");
+        CHECK(a == 0);
+        auto ab = LEXY_VERIFY("ab");
+        CHECK(ab == 1);
+
+        auto b = LEXY_VERIFY("b");
+        CHECK(b == 2);
+        auto bbb = LEXY_VERIFY("bbb");
+        CHECK(bbb == 2);
+
+        auto c = LEXY_VERIFY("c");
+        CHECK(c == 3);
+
+        auto abc = LEXY_VERIFY("abc");
+        CHECK(abc == -1);
+    }
+    SUBCASE("non-literals first")
+    {
+        static constexpr auto rule
+            = lexy::dsl::switch_(word)
+                  .case_(token(while_one(lexy::dsl::lit_c<'a'>)) >> label<0>)
+                  .case_(LEXY_LIT("a") >> label<1>)
+                  .case_(LEXY_LIT("b") >> label<2>);
+        CHECK(lexy::is_rule<decltype(rule)>);
+
+        struct callback
+        {
+            const char* str;
+
+            LEXY_VERIFY_FN int success(const char*, id<0>)
+            {
+                return 0;
+            }
+
+            LEXY_VERIFY_FN int success(const char*, id<1>)
+            {
+                return 1;
+            }
+
+            LEXY_VERIFY_FN int success(const char*, id<2>)
+            {
+                return 2;
+            }
+
+            LEXY_VERIFY_FN int error(test_error<lexy::exhausted_switch> e)
+            {
+                LEXY_VERIFY_CHECK(e.begin() == str);
+                return -1;
+            }
+
+            LEXY_VERIFY_FN int error(test_error<lexy::expected_char_class> e)
+            {
+                LEXY_VERIFY_CHECK(e.position() == str);
+                return -2;
+            }
+        };
+
+        auto empty = LEXY_VERIFY("");
+        CHECK(empty == -2);
+
+        auto a = LEXY_VERIFY("a");
+        CHECK(a == 0);
+        auto aa = LEXY_VERIFY("aa");
+        CHECK(aa == 0);
+        auto b = LEXY_VERIFY("b");
+        CHECK(b == 2);
+
+        auto c = LEXY_VERIFY("c");
+        CHECK(c == -1);
+    }
+    SUBCASE("duplicate literals")
+    {
+        static constexpr auto rule = lexy::dsl::switch_(word)
+                                         .case_(LEXY_LIT("ab") >> label<0>)
+                                         .case_(LEXY_LIT("a") >> label<1>)
+                                         .case_(LEXY_LIT("ab") >> label<2>)
+                                         .case_(LEXY_LIT("b") >> label<3>);
+        CHECK(lexy::is_rule<decltype(rule)>);
+
+        struct callback
+        {
+            const char* str;
+
+            LEXY_VERIFY_FN int success(const char*, id<0>)
+            {
+                return 0;
+            }
+
+            LEXY_VERIFY_FN int success(const char*, id<1>)
+            {
+                return 1;
+            }
+
+            LEXY_VERIFY_FN int success(const char*, id<2>)
+            {
+                return 2;
+            }
+
+            LEXY_VERIFY_FN int success(const char*, id<3>)
+            {
+                return 3;
+            }
+
+            LEXY_VERIFY_FN int error(test_error<lexy::exhausted_switch> e)
+            {
+                LEXY_VERIFY_CHECK(e.begin() == str);
+                return -1;
+            }
+
+            LEXY_VERIFY_FN int error(test_error<lexy::expected_char_class> e)
+            {
+                LEXY_VERIFY_CHECK(e.position() == str);
+                return -2;
+            }
+        };
+
+        auto empty = LEXY_VERIFY("");
+        CHECK(empty == -2);
+
+        auto ab = LEXY_VERIFY("ab");
+        CHECK(ab == 0);
+        auto a = LEXY_VERIFY("a");
+        CHECK(a == 1);
+        auto b = LEXY_VERIFY("b");
+        CHECK(b == 3);
+
+        auto abc = LEXY_VERIFY("abc");
+        CHECK(abc == -1);
+    }
+    SUBCASE("default")
+    {
+        static constexpr auto rule = lexy::dsl::switch_(word)
+                                         .case_(LEXY_LIT("a") >> label<0>)
+                                         .case_(LEXY_LIT("b") >> label<1>)
+                                         .default_(label<2>);
+        CHECK(lexy::is_rule<decltype(rule)>);
+
+        struct callback
+        {
+            const char* str;
+
+            LEXY_VERIFY_FN int success(const char*, id<0>)
+            {
+                return 0;
+            }
+            LEXY_VERIFY_FN int success(const char*, id<1>)
+            {
+                return 1;
+            }
+            LEXY_VERIFY_FN int success(const char* cur, id<2>)
+            {
+                LEXY_VERIFY_CHECK(cur == str + lexy::_detail::string_view(str).size());
+                return 2;
+            }
+
+            LEXY_VERIFY_FN int error(test_error<lexy::expected_char_class> e)
+            {
+                LEXY_VERIFY_CHECK(e.position() == str);
+                return -2;
+            }
+        };
+
+        auto empty = LEXY_VERIFY("");
+        CHECK(empty == -2);
+
+        auto a = LEXY_VERIFY("a");
+        CHECK(a == 0);
+        auto b = LEXY_VERIFY("b");
+        CHECK(b == 1);
+
+        auto c = LEXY_VERIFY("c");
+        CHECK(c == 2);
+        auto abc = LEXY_VERIFY("abc");
+        CHECK(abc == 2);
+    }
+    SUBCASE("error")
+    {
+        struct tag;
+
+        static constexpr auto rule = lexy::dsl::switch_(word)
+                                         .case_(LEXY_LIT("a") >> label<0>)
+                                         .case_(LEXY_LIT("b") >> label<1>)
+                                         .error<tag>;
+        CHECK(lexy::is_rule<decltype(rule)>);
+
+        struct callback
+        {
+            const char* str;
+
+            LEXY_VERIFY_FN int success(const char*, id<0>)
+            {
+                return 0;
+            }
+
+            LEXY_VERIFY_FN int success(const char*, id<1>)
+            {
+                return 1;
+            }
+
+            LEXY_VERIFY_FN int error(test_error<tag> e)
+            {
+                LEXY_VERIFY_CHECK(e.begin() == str);
+                LEXY_VERIFY_CHECK(e.end() == str + lexy::_detail::string_view(str).size());
+                return -1;
+            }
+
+            LEXY_VERIFY_FN int error(test_error<lexy::expected_char_class> e)
+            {
+                LEXY_VERIFY_CHECK(e.position() == str);
+                return -2;
+            }
+        };
+
+        auto empty = LEXY_VERIFY("");
+        CHECK(empty == -2);
+
+        auto a = LEXY_VERIFY("a");
+        CHECK(a == 0);
+        auto b = LEXY_VERIFY("b");
+        CHECK(b == 1);
+
+        auto c = LEXY_VERIFY("c");
+        CHECK(c == -1);
+        auto abc = LEXY_VERIFY("abc");
+        CHECK(abc == -1);
+    }
+}
+
@@ -68,6 +68,11 @@ constexpr auto symbols = lexy::symbol_table<int> //
                              .map<'B'>(1)
                              .map<'C'>(2)
                              .map<LEXY_SYMBOL("Abc")>(3);
+
+constexpr auto single_symbols = lexy::symbol_table<int> //
+                                    .map<'A'>(0)
+                                    .map<'B'>(1)
+                                    .map<'C'>(2);
 }
 
 TEST_CASE("dsl::symbol")
@@ -117,6 +122,43 @@ TEST_CASE("dsl::symbol")
         auto ab = LEXY_VERIFY("Ab");
         CHECK(ab == 0);
     }
+    SUBCASE("single code units")
+    {
+        static constexpr auto rule = lexy::dsl::symbol<single_symbols>;
+        CHECK(lexy::is_rule<decltype(rule)>);
+
+        struct callback
+        {
+            const char* str;
+
+            LEXY_VERIFY_FN int success(const char* cur, int i)
+            {
+                LEXY_VERIFY_CHECK(cur - str == 1);
+                return i;
+            }
+
+            LEXY_VERIFY_FN int error(test_error<lexy::unknown_symbol> e)
+            {
+                LEXY_VERIFY_CHECK(e.position() == str);
+                return -1;
+            }
+        };
+
+        auto empty = LEXY_VERIFY("");
+        CHECK(empty == -1);
+
+        auto a = LEXY_VERIFY("A");
+        CHECK(a == 0);
+        auto b = LEXY_VERIFY("B");
+        CHECK(b == 1);
+        auto c = LEXY_VERIFY("Cde");
+        CHECK(c == 2);
+
+        auto unknown = LEXY_VERIFY("D");
+        CHECK(unknown == -1);
+        auto lower = LEXY_VERIFY("a");
+        CHECK(lower == -1);
+    }
     SUBCASE("branch")
     {
         static constexpr auto rule = opt(lexy::dsl::symbol<symbols>);
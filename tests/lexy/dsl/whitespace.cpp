@@ -6,9 +6,12 @@
 
 #include "verify.hpp"
 #include <lexy/dsl/alternative.hpp>
+#include <lexy/dsl/ascii.hpp>
 #include <lexy/dsl/if.hpp>
 #include <lexy/dsl/label.hpp>
+#include <lexy/dsl/newline.hpp>
 #include <lexy/dsl/production.hpp>
+#include <lexy/dsl/until.hpp>
 
 namespace
 {
@@ -116,6 +119,49 @@ TEST_CASE("dsl::whitespace")
         auto partial_token = LEXY_VERIFY("12");
         CHECK(partial_token == 0);
     }
+    SUBCASE("explicit comments")
+    {
+        static constexpr auto rule = lexy::dsl::whitespace(
+            lexy::dsl::ascii::space                                                    //
+            | LEXY_LIT("//") >> lexy::dsl::until(lexy::dsl::newline).or_eof()          //
+            | LEXY_LIT("/*") >> lexy::dsl::until(LEXY_LIT("*/")));
+        CHECK(lexy::is_rule<decltype(rule)>);
+
+        struct callback
+        {
+            const char* str;
+
+            LEXY_VERIFY_FN int success(const char* cur)
+            {
+                return int(cur - str);
+            }
+
+            LEXY_VERIFY_FN int error(test_error<lexy::expected_literal> e)
+            {
+                LEXY_VERIFY_CHECK(e.string() == lexy::_detail::string_view("*/"));
+                return -1;
+            }
+        };
+
+        auto empty = LEXY_VERIFY("");
+        CHECK(empty == 0);
+
+        auto spaces = LEXY_VERIFY("  \t\n ");
+        CHECK(spaces == 5);
+        auto line = LEXY_VERIFY("// abc\n  ");
+        CHECK(line == 9);
+        auto line_eof = LEXY_VERIFY(" // abc");
+        CHECK(line_eof == 7);
+        auto block = LEXY_VERIFY("/* a\nb */ x");
+        CHECK(block == 10);
+        auto mixed = LEXY_VERIFY(" /**/ // a\n/* b */\n");
+        CHECK(mixed == 19);
+        auto slash = LEXY_VERIFY("  / ");
+        CHECK(slash == 2);
+
+        auto unterminated = LEXY_VERIFY(" /* abc");
+        CHECK(unterminated == -1);
+    }
 
     SUBCASE("explicit whitespace operators")
     {
@@ -45,6 +45,7 @@ namespace
 constexpr auto trie_a     = lexy::shallow_trie<LEXY_NTTP_STRING("a")>;
 constexpr auto trie_abc   = lexy::shallow_trie<LEXY_NTTP_STRING("abc")>;
 constexpr auto trie_abc_u = lexy::shallow_trie<LEXY_NTTP_STRING(u"abc")>;
+constexpr auto trie_punct = lexy::shallow_trie<LEXY_NTTP_STRING("!#$%&*+-/<=>?@^|~")>;
 } // namespace
 
 TEST_CASE("engine_char_set")
@@ -132,6 +133,35 @@ TEST_CASE("engine_char_set")
         CHECK(d.count == 0);
         CHECK(d.recovered == 1);
     }
+
+    SUBCASE("punctuation")
+    {
+        using engine = lexy::engine_char_set<trie_punct>;
+        CHECK(lexy::engine_is_matcher<engine>);
+
+        auto empty = engine_matches<engine>("");
+        CHECK(!empty);
+        CHECK(empty.count == 0);
+        CHECK(empty.recovered == 0);
+
+        for (auto c = 0x01; c <= 0xFF; ++c)
+        {
+            INFO(c);
+            const char str[] = {char(c), char(c), char(c), '\0'};
+            auto       is_punct
+                = lexy::_detail::string_view("!#$%&*+-/<=>?@^|~").find(char(c)) != std::size_t(-1);
+
+            auto result = engine_matches<engine>(str);
+            CHECK(bool(result) == is_punct);
+            CHECK(result.count == 0u + is_punct);
+
+            auto ascii = engine_matches<engine, lexy::ascii_encoding>(str);
+            CHECK(bool(ascii) == is_punct);
+
+            auto utf8 = engine_matches<engine, lexy::utf8_encoding>(str);
+            CHECK(bool(utf8) == is_punct);
+        }
+    }
 }
 
 namespace
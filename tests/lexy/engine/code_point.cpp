@@ -72,9 +72,8 @@ TEST_CASE("engine_cp_ascii")
     }
 }
 
-TEST_CASE("engine_cp_utf8")
+TEST_CASE_TEMPLATE("engine_cp_utf8", engine, lexy::engine_cp_utf8, lexy::engine_cp_utf8_table)
 {
-    using engine = lexy::engine_cp_utf8;
     CHECK(lexy::engine_is_matcher<engine>);
     CHECK(lexy::engine_is_parser<engine>);
 
@@ -240,9 +239,30 @@ TEST_CASE("engine_cp_utf8")
     }
 }
 
-TEST_CASE("engine_cp_utf16")
+TEST_CASE("engine_cp_utf8_table")
+{
+    // The table decoder has the same results as the regular one on every input.
+    for (auto first = 0x00; first <= 0xFF; ++first)
+        for (auto second = 0x00; second <= 0xFF; ++second)
+            for (auto rest : {0x00, 0x80, 0xBF, 0xC3})
+            {
+                INFO(first);
+                INFO(second);
+                INFO(rest);
+
+                const LEXY_CHAR8_T str[] = {LEXY_CHAR8_T(first), LEXY_CHAR8_T(second),
+                                            LEXY_CHAR8_T(rest), LEXY_CHAR8_T(rest), 0x0};
+                auto expected = engine_parses<lexy::engine_cp_utf8, lexy::utf8_encoding>(str);
+                auto actual = engine_parses<lexy::engine_cp_utf8_table, lexy::utf8_encoding>(str);
+                CHECK(actual.ec == expected.ec);
+                CHECK(actual.count == expected.count);
+                CHECK(actual.recovered == expected.recovered);
+                CHECK(actual.value.value() == expected.value.value());
+            }
+}
+
+TEST_CASE_TEMPLATE("engine_cp_utf16", engine, lexy::engine_cp_utf16, lexy::engine_cp_utf16_table)
 {
-    using engine = lexy::engine_cp_utf16;
     CHECK(lexy::engine_is_matcher<engine>);
     CHECK(lexy::engine_is_parser<engine>);
 
@@ -281,6 +301,10 @@ TEST_CASE("engine_cp_utf16")
         CHECK(emojii);
         CHECK(emojii.count == 2);
         CHECK(emojii.value.value() == 0x1F642);
+        auto max = parse(u"\U0010FFFF");
+        CHECK(max);
+        CHECK(max.count == 2);
+        CHECK(max.value.value() == 0x10FFFF);
 
         constexpr char16_t leads_with_trailing_str[] = {0xDC44, 0x0};
         auto               leads_with_trailing       = parse(leads_with_trailing_str);
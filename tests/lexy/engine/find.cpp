@@ -6,12 +6,19 @@
 
 #include "verify.hpp"
 #include <lexy/_detail/nttp_string.hpp>
+#include <lexy/engine/char_class.hpp>
 #include <lexy/engine/literal.hpp>
+#include <lexy/engine/trie.hpp>
 
 namespace
 {
 constexpr auto trie_ab    = lexy::linear_trie<LEXY_NTTP_STRING("ab")>;
 constexpr auto trie_limit = lexy::linear_trie<LEXY_NTTP_STRING("!")>;
+constexpr auto trie_xyz   = lexy::shallow_trie<LEXY_NTTP_STRING("xyz")>;
+constexpr auto trie_kw
+    = lexy::trie<char, LEXY_NTTP_STRING("if"), LEXY_NTTP_STRING("else"), LEXY_NTTP_STRING("for"),
+                 LEXY_NTTP_STRING("while"), LEXY_NTTP_STRING("do"), LEXY_NTTP_STRING("return"),
+                 LEXY_NTTP_STRING(";")>;
 } // namespace
 
 TEST_CASE("engine_find")
@@ -51,6 +58,57 @@ TEST_CASE("engine_find")
     CHECK(!unterminated);
     CHECK(unterminated.count == 2);
     CHECK(unterminated.ec == engine::error_code::not_found);
+
+    auto long_ = engine_matches<engine>("+-+-+-+-+-+-+-+-+-+-ab");
+    CHECK(long_);
+    CHECK(long_.count == 20);
+    auto long_partial = engine_matches<engine>("+-+-+-+-+-a-+-+-+-+-aab");
+    CHECK(long_partial);
+    CHECK(long_partial.count == 21);
+    auto long_unterminated = engine_matches<engine>("+-+-+-+-+-a-+-+-+-+-a");
+    CHECK(!long_unterminated);
+    CHECK(long_unterminated.count == 21);
+    CHECK(long_unterminated.ec == engine::error_code::not_found);
+
+    SUBCASE("char set")
+    {
+        using set_engine = lexy::engine_find<lexy::engine_char_set<trie_xyz>>;
+
+        auto set_zero = engine_matches<set_engine>("y");
+        CHECK(set_zero);
+        CHECK(set_zero.count == 0);
+        auto set_long = engine_matches<set_engine>("abcdefghijklmnopqrstuvwzyx");
+        CHECK(set_long);
+        CHECK(set_long.count == 23);
+        auto set_unterminated = engine_matches<set_engine>("abcdefghijklmnopqrstuvw");
+        CHECK(!set_unterminated);
+        CHECK(set_unterminated.count == 23);
+    }
+    SUBCASE("trie")
+    {
+        using trie_engine = lexy::engine_find<lexy::engine_trie<trie_kw>>;
+
+        auto trie_zero = engine_matches<trie_engine>("while");
+        CHECK(trie_zero);
+        CHECK(trie_zero.count == 0);
+        auto trie_long = engine_matches<trie_engine>("e f w d r abcdefghijklmnopfor");
+        CHECK(trie_long);
+        CHECK(trie_long.count == 26);
+        auto trie_partial = engine_matches<trie_engine>("ifelsefor");
+        CHECK(trie_partial);
+        CHECK(trie_partial.count == 0);
+        auto trie_candidates = engine_matches<trie_engine>("rereturn elwhile dfo whil ret do");
+        CHECK(trie_candidates);
+        CHECK(trie_candidates.count == 2);
+        auto trie_single = engine_matches<trie_engine>("abcdefghijklmnopqrstuvwxyz;");
+        CHECK(trie_single);
+        CHECK(trie_single.count == 26);
+
+        auto trie_unterminated = engine_matches<trie_engine>("abcdefghijklmnopqrstuvwxyzwhil");
+        CHECK(!trie_unterminated);
+        CHECK(trie_unterminated.count == 30);
+        CHECK(trie_unterminated.ec == trie_engine::error_code::not_found);
+    }
 }
 
 TEST_CASE("engine_find_before")
@@ -96,5 +154,13 @@ TEST_CASE("engine_find_before")
     CHECK(!limited);
     CHECK(limited.count == 2);
     CHECK(limited.ec == engine::error_code::not_found_limit);
+
+    auto long_ = engine_matches<engine>("+-+-+-+-+-+-+-+-+-+-ab!");
+    CHECK(long_);
+    CHECK(long_.count == 20);
+    auto long_limited = engine_matches<engine>("+-+-+-+-+-a-+-+-+-+-!ab");
+    CHECK(!long_limited);
+    CHECK(long_limited.count == 20);
+    CHECK(long_limited.ec == engine::error_code::not_found_limit);
 }
 
@@ -14,6 +14,7 @@ constexpr auto trie_a     = lexy::linear_trie<LEXY_NTTP_STRING("a")>;
 constexpr auto trie_ab    = lexy::linear_trie<LEXY_NTTP_STRING("ab")>;
 constexpr auto trie_abc   = lexy::linear_trie<LEXY_NTTP_STRING("abc")>;
 constexpr auto trie_abc_u = lexy::linear_trie<LEXY_NTTP_STRING(u"abc")>;
+constexpr auto trie_long  = lexy::linear_trie<LEXY_NTTP_STRING("abcdefghijk")>;
 } // namespace
 
 TEST_CASE("engine_literal")
@@ -117,6 +118,41 @@ TEST_CASE("engine_literal")
         CHECK(!b);
         CHECK(b.count == 0);
     }
+    SUBCASE("abcdefghijk")
+    {
+        using engine = lexy::engine_literal<trie_long>;
+        CHECK(lexy::engine_is_matcher<engine>);
+
+        auto empty = engine_matches<engine>("");
+        CHECK(!empty);
+        CHECK(empty.count == 0);
+        CHECK(empty.ec == engine::index_to_error(0));
+
+        auto abcdefghij = engine_matches<engine>("abcdefghij");
+        CHECK(!abcdefghij);
+        CHECK(abcdefghij.count == 10);
+        CHECK(abcdefghij.ec == engine::index_to_error(10));
+
+        auto abcdefghijk = engine_matches<engine>("abcdefghijk");
+        CHECK(abcdefghijk);
+        CHECK(abcdefghijk.count == 11);
+        auto abcdefghijkl = engine_matches<engine>("abcdefghijkl");
+        CHECK(abcdefghijkl);
+        CHECK(abcdefghijkl.count == 11);
+
+        auto abcdXfghijk = engine_matches<engine>("abcdXfghijk");
+        CHECK(!abcdXfghijk);
+        CHECK(abcdXfghijk.count == 4);
+        CHECK(abcdXfghijk.ec == engine::index_to_error(4));
+        auto abcdefghiXk = engine_matches<engine>("abcdefghiXkl");
+        CHECK(!abcdefghiXk);
+        CHECK(abcdefghiXk.count == 9);
+        CHECK(abcdefghiXk.ec == engine::index_to_error(9));
+        auto abcdefghijX = engine_matches<engine>("abcdefghijX");
+        CHECK(!abcdefghijX);
+        CHECK(abcdefghijX.count == 10);
+        CHECK(abcdefghijX.ec == engine::index_to_error(10));
+    }
     SUBCASE("abc in UTF-16")
     {
         using engine = lexy::engine_literal<trie_abc_u>;
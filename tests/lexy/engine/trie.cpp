@@ -183,3 +183,72 @@ TEST_CASE("engine_trie")
     }
 }
 
+namespace
+{
+#define LEXY_TEST_KEYWORDS(K)                                                                      \
+    K("auto"), K("break"), K("case"), K("char"), K("const"), K("continue"), K("default"),          \
+        K("do"), K("double"), K("else"), K("enum"), K("extern"), K("float"), K("for"),             \
+        K("goto"), K("if"), K("inline"), K("int"), K("long"), K("register"), K("restrict"),        \
+        K("return"), K("short"), K("signed"), K("sizeof"), K("static"), K("struct"),               \
+        K("switch"), K("typedef"), K("union"), K("unsigned"), K("void"), K("volatile"),            \
+        K("while"), K("_Alignas"), K("_Alignof"), K("_Atomic"), K("_Bool"), K("_Complex"),         \
+        K("_Generic"), K("_Imaginary"), K("_Noreturn"), K("_Static_assert"), K("_Thread_local")
+
+#define LEXY_TEST_CHAR(Str) LEXY_NTTP_STRING(Str)
+#define LEXY_TEST_CHAR16(Str) LEXY_NTTP_STRING(u##Str)
+
+constexpr auto trie_keywords   = lexy::trie<char, LEXY_TEST_KEYWORDS(LEXY_TEST_CHAR)>;
+constexpr auto trie_keywords_u = lexy::trie<char16_t, LEXY_TEST_KEYWORDS(LEXY_TEST_CHAR16)>;
+
+#undef LEXY_TEST_CHAR16
+#undef LEXY_TEST_CHAR
+#undef LEXY_TEST_KEYWORDS
+} // namespace
+
+TEST_CASE("engine_trie table")
+{
+    CHECK(trie_keywords.node_count() > LEXY_ENGINE_TRIE_TABLE_THRESHOLD);
+
+    auto check = [](auto engine, auto str, std::size_t count, std::size_t value) {
+        auto match_result = engine_matches<decltype(engine)>(str);
+        auto parse_result = engine_parses<decltype(engine)>(str);
+        CHECK(match_result.ec == parse_result.ec);
+        CHECK(match_result.count == count);
+        CHECK(parse_result.count == count);
+        CHECK(parse_result.value == value);
+    };
+
+    SUBCASE("char")
+    {
+        using engine           = lexy::engine_trie<trie_keywords>;
+        constexpr auto invalid = trie_keywords.invalid_value;
+
+        check(engine{}, "", 0, invalid);
+        check(engine{}, "auto", 4, 0);
+        check(engine{}, "do", 2, 7);
+        check(engine{}, "double", 6, 8);
+        check(engine{}, "dou", 2, 7);
+        check(engine{}, "int", 3, 17);
+        check(engine{}, "int8", 3, 17);
+        check(engine{}, "inline", 6, 16);
+        check(engine{}, "in", 2, invalid);
+        check(engine{}, "while", 5, 33);
+        check(engine{}, "_Bool", 5, 37);
+        check(engine{}, "_Static_assert", 14, 42);
+        check(engine{}, "_Static", 7, invalid);
+        check(engine{}, "x", 0, invalid);
+        check(engine{}, "\xFF", 0, invalid);
+    }
+    SUBCASE("char16_t")
+    {
+        using engine           = lexy::engine_trie<trie_keywords_u>;
+        constexpr auto invalid = trie_keywords_u.invalid_value;
+
+        check(engine{}, u"", 0, invalid);
+        check(engine{}, u"double", 6, 8);
+        check(engine{}, u"dou", 2, 7);
+        check(engine{}, u"in", 2, invalid);
+        check(engine{}, u"_Thread_local", 13, 43);
+        check(engine{}, u"ä", 0, invalid);
+    }
+}
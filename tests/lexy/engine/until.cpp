@@ -10,7 +10,8 @@
 
 namespace
 {
-constexpr auto trie_ab = lexy::linear_trie<LEXY_NTTP_STRING("ab")>;
+constexpr auto trie_ab  = lexy::linear_trie<LEXY_NTTP_STRING("ab")>;
+constexpr auto trie_end = lexy::linear_trie<LEXY_NTTP_STRING("]]>")>;
 }
 
 TEST_CASE("engine_until")
@@ -52,6 +53,34 @@ TEST_CASE("engine_until")
     CHECK(unterminated.ec == condition::index_to_error(0));
 }
 
+TEST_CASE("engine_until long input")
+{
+    using condition = lexy::engine_literal<trie_end>;
+    using engine    = lexy::engine_until<condition>;
+
+    auto start = engine_matches<engine>("]]>abcdefghijklmnopqrstuvwxyz");
+    CHECK(start);
+    CHECK(start.count == 3);
+    auto middle = engine_matches<engine>("abcdefghijklmnop]]>qrstuvwxyz");
+    CHECK(middle);
+    CHECK(middle.count == 19);
+    auto end = engine_matches<engine>("abcdefghijklmnopqrstuvwxyz]]>");
+    CHECK(end);
+    CHECK(end.count == 29);
+
+    auto candidates = engine_matches<engine>("]x>]]]]x>]]]]]]]]]]]]]>abc");
+    CHECK(candidates);
+    CHECK(candidates.count == 23);
+    auto overlapping = engine_matches<engine>("]]]]]]]]]]]]]]]]]]]]]]]]>");
+    CHECK(overlapping);
+    CHECK(overlapping.count == 25);
+
+    auto unterminated = engine_matches<engine>("abcdefghijklmnopqrstuvwxyz]]");
+    CHECK(!unterminated);
+    CHECK(unterminated.count == 28);
+    CHECK(unterminated.ec == condition::index_to_error(0));
+}
+
 TEST_CASE("engine_until_eof")
 {
     using condition = lexy::engine_literal<trie_ab>;
@@ -6,12 +6,14 @@
 
 #include "verify.hpp"
 #include <lexy/_detail/nttp_string.hpp>
+#include <lexy/engine/char_class.hpp>
 #include <lexy/engine/literal.hpp>
 
 namespace
 {
-constexpr auto trie = lexy::linear_trie<LEXY_NTTP_STRING("ab")>;
-}
+constexpr auto trie        = lexy::linear_trie<LEXY_NTTP_STRING("ab")>;
+constexpr auto strie_space = lexy::shallow_trie<LEXY_NTTP_STRING(" \t")>;
+} // namespace
 
 TEST_CASE("engine_while")
 {
@@ -38,3 +40,41 @@ TEST_CASE("engine_while")
     CHECK(partial.count == 2);
 }
 
+TEST_CASE("engine_while char class")
+{
+    auto check = [](auto engine, const char* str, std::size_t count) {
+        auto result = engine_matches<decltype(engine)>(str);
+        CHECK(result);
+        CHECK(result.count == count);
+
+        auto utf8 = engine_matches<decltype(engine), lexy::utf8_encoding>(str);
+        CHECK(utf8);
+        CHECK(utf8.count == count);
+    };
+
+    SUBCASE("char_range")
+    {
+        using engine = lexy::engine_while<lexy::engine_char_range<'0', '9'>>;
+        check(engine{}, "", 0);
+        check(engine{}, "a", 0);
+        check(engine{}, "123a", 3);
+        check(engine{}, "0123456789", 10);
+        check(engine{}, "01234567890123456789a", 20);
+        check(engine{}, "01234567\xFF", 8);
+    }
+    SUBCASE("char_set")
+    {
+        using engine = lexy::engine_while<lexy::engine_char_set<strie_space>>;
+        check(engine{}, "", 0);
+        check(engine{}, " \t \ta", 4);
+        check(engine{}, " \t \t \t \t \t \t", 12);
+        check(engine{}, " \t \t \t \t \t \t\n", 12);
+    }
+    SUBCASE("char_range non-ASCII")
+    {
+        using matcher = lexy::engine_char_range<(unsigned char)0x80, (unsigned char)0xFF>;
+        using engine  = lexy::engine_while<matcher>;
+        check(engine{}, "", 0);
+        check(engine{}, "\x80\x81\x82\x83\x84\x85\x86\x87\x88\xFF!", 10);
+    }
+}
@@ -199,7 +199,7 @@ TEST_CASE("buffer")
         CHECK(other.size() == 0);
     }
 
-    SUBCASE("reader, no sentinel")
+    SUBCASE("reader, default encoding")
     {
         const lexy::buffer buffer(str, 3);
 
@@ -223,7 +223,7 @@ TEST_CASE("buffer")
         CHECK(reader.peek() == lexy::default_encoding::eof());
         CHECK(reader.eof());
     }
-    SUBCASE("reader, sentinel")
+    SUBCASE("reader, ascii encoding")
     {
         const lexy::buffer<lexy::ascii_encoding> buffer(str, 3);
 
@@ -247,6 +247,65 @@ TEST_CASE("buffer")
         CHECK(reader.peek() == lexy::default_encoding::eof());
         CHECK(reader.eof());
     }
+    SUBCASE("reader, empty buffer")
+    {
+        const lexy::buffer<> default_;
+        CHECK(default_.reader().peek() == lexy::default_encoding::eof());
+        CHECK(default_.reader().eof());
+
+        const lexy::buffer<lexy::utf8_encoding> utf8;
+        CHECK(utf8.reader().peek() == lexy::utf8_encoding::eof());
+        CHECK(utf8.reader().eof());
+
+        const lexy::buffer<lexy::utf16_encoding> utf16;
+        CHECK(utf16.reader().peek() == lexy::utf16_encoding::eof());
+        CHECK(utf16.reader().eof());
+
+        // A moved-from buffer is empty as well.
+        lexy::buffer<> original(str, 3);
+        auto           moved = LEXY_MOV(original);
+        CHECK(moved.size() == 3);
+        CHECK(original.reader().peek() == lexy::default_encoding::eof());
+        CHECK(original.reader().eof());
+    }
+    SUBCASE("reader, sentinel in input")
+    {
+        static const char16_t sentinel_str[] = {u'a', 0xFFFF, u'b'};
+        const lexy::buffer<lexy::utf16_encoding> buffer(sentinel_str, 3);
+
+        auto reader = buffer.reader();
+        CHECK(reader.peek() == 'a');
+        CHECK(!reader.eof());
+
+        reader.bump();
+        CHECK(reader.peek() == 0xFFFF);
+        CHECK(!reader.eof());
+
+        reader.bump();
+        CHECK(reader.peek() == 'b');
+        CHECK(!reader.eof());
+
+        reader.bump();
+        CHECK(reader.cur() == buffer.data() + 3);
+        CHECK(reader.peek() == lexy::utf16_encoding::eof());
+        CHECK(reader.eof());
+    }
+    SUBCASE("reader, padding")
+    {
+        const lexy::buffer default_(str, 3);
+        CHECK(lexy::_reader_padding<decltype(default_.reader())> == lexy::_detail::swar_length);
+        for (auto i = 0u; i != lexy::_detail::swar_length; ++i)
+            CHECK(default_.data()[3 + i] == '\xFF');
+
+        const lexy::buffer<lexy::ascii_encoding> ascii(str, 3);
+        CHECK(lexy::_reader_padding<decltype(ascii.reader())> == lexy::_detail::swar_length);
+        for (auto i = 0u; i != lexy::_detail::swar_length; ++i)
+            CHECK(ascii.data()[3 + i] == lexy::ascii_encoding::eof());
+
+        const lexy::buffer<lexy::utf32_encoding> utf32(U"abc", 3);
+        CHECK(lexy::_reader_padding<decltype(utf32.reader())> == 1);
+        CHECK(utf32.data()[3] == char32_t(0xFFFF'FFFF));
+    }
 }
 
 TEST_CASE("make_buffer")
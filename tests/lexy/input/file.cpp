@@ -7,6 +7,8 @@
 
 #include <cstdio>
 #include <doctest/doctest.h>
+#include <lexy/lexeme.hpp>
+#include <string>
 
 #if defined(__has_include) && __has_include(<memory_resource>)
 #    include <memory_resource>
@@ -217,6 +219,257 @@ TEST_CASE("read_file")
     std::remove(test_file_name);
 }
 
+TEST_CASE("map_file")
+{
+    std::remove(test_file_name);
+
+    SUBCASE("non-existing file")
+    {
+        auto result = lexy::map_file(test_file_name);
+        CHECK(!result);
+        CHECK(result.error() == lexy::file_error::file_not_found);
+    }
+    SUBCASE("empty file")
+    {
+        write_test_data("");
+
+        auto result = lexy::map_file(test_file_name);
+        REQUIRE(result);
+        CHECK(result.file().size() == 0);
+
+        auto reader = result.file().reader();
+        CHECK(reader.peek() == lexy::default_encoding::eof());
+        CHECK(reader.eof());
+    }
+    SUBCASE("tiny file")
+    {
+        write_test_data("abc");
+
+        auto result = lexy::map_file(test_file_name);
+        REQUIRE(result);
+        CHECK(result.file().size() == 3);
+
+        auto reader = result.file().reader();
+        CHECK(reader.peek() == 'a');
+        CHECK(!reader.eof());
+
+        reader.bump();
+        CHECK(reader.peek() == 'b');
+        CHECK(!reader.eof());
+
+        reader.bump();
+        CHECK(reader.peek() == 'c');
+        CHECK(!reader.eof());
+
+        reader.bump();
+        CHECK(reader.peek() == lexy::default_encoding::eof());
+        CHECK(reader.eof());
+    }
+    SUBCASE("big file")
+    {
+        {
+            auto file = std::fopen(test_file_name, "wb");
+            for (auto i = 0; i != 200 * 1024; ++i)
+                std::fputc('a', file);
+            for (auto i = 0; i != 200 * 1024; ++i)
+                std::fputc('b', file);
+            std::fclose(file);
+        }
+
+        auto result = lexy::map_file(test_file_name);
+        REQUIRE(result);
+
+        // The file outlives the result.
+        auto file   = LEXY_MOV(result).file();
+        auto reader = file.reader();
+        for (auto i = 0; i != 200 * 1024; ++i)
+        {
+            CHECK(reader.peek() == 'a');
+            CHECK(!reader.eof());
+            reader.bump();
+        }
+
+        // Lexemes point directly into the file.
+        auto begin = reader.cur();
+        for (auto i = 0; i != 200 * 1024; ++i)
+        {
+            CHECK(reader.peek() == 'b');
+            CHECK(!reader.eof());
+            reader.bump();
+        }
+        auto lexeme = lexy::lexeme<decltype(reader)>(begin, reader.cur());
+        CHECK(lexeme.begin() == file.data() + 200 * 1024);
+        CHECK(lexeme.size() == 200 * 1024);
+
+        CHECK(reader.peek() == lexy::default_encoding::eof());
+        CHECK(reader.eof());
+    }
+    SUBCASE("UTF-8 with BOM")
+    {
+        write_test_data("\xEF\xBB\xBF"
+                        "abc");
+
+        auto result = lexy::map_file<lexy::utf8_encoding>(test_file_name);
+        REQUIRE(result);
+        CHECK(result.file().size() == 3);
+
+        auto reader = result.file().reader();
+        CHECK(reader.peek() == 'a');
+        CHECK(!reader.eof());
+    }
+
+    std::remove(test_file_name);
+}
+
+TEST_CASE("open_chunked_file")
+{
+    std::remove(test_file_name);
+
+    auto chunk_string = [](const auto& file) { return std::string(file.data(), file.size()); };
+
+    SUBCASE("non-existing file")
+    {
+        auto result = lexy::open_chunked_file(test_file_name);
+        CHECK(!result);
+        CHECK(result.error() == lexy::file_error::file_not_found);
+    }
+    SUBCASE("empty file")
+    {
+        write_test_data("");
+
+        auto result = lexy::open_chunked_file(test_file_name);
+        REQUIRE(result);
+
+        auto file = LEXY_MOV(result).file();
+        CHECK(!file.next_chunk());
+        CHECK(file.error() == lexy::file_error::_success);
+    }
+    SUBCASE("single chunk")
+    {
+        write_test_data("abc\ndef\n");
+
+        auto result = lexy::open_chunked_file(test_file_name);
+        REQUIRE(result);
+
+        auto file = LEXY_MOV(result).file();
+        REQUIRE(file.next_chunk());
+        CHECK(chunk_string(file) == "abc\ndef\n");
+
+        auto reader = file.reader();
+        CHECK(reader.peek() == 'a');
+        CHECK(reader.cur() == file.data());
+
+        CHECK(!file.next_chunk());
+        CHECK(file.error() == lexy::file_error::_success);
+    }
+    SUBCASE("multiple chunks")
+    {
+        write_test_data("abc\ndef\nghi\nj");
+
+        auto result = lexy::open_chunked_file(test_file_name, '\n', 6);
+        REQUIRE(result);
+
+        auto file = LEXY_MOV(result).file();
+        REQUIRE(file.next_chunk());
+        CHECK(chunk_string(file) == "abc\n");
+        REQUIRE(file.next_chunk());
+        CHECK(chunk_string(file) == "def\n");
+        REQUIRE(file.next_chunk());
+        CHECK(chunk_string(file) == "ghi\n");
+        REQUIRE(file.next_chunk());
+        CHECK(chunk_string(file) == "j");
+        CHECK(!file.next_chunk());
+    }
+    SUBCASE("record bigger than block")
+    {
+        write_test_data("a;bcdefghijklmnopqrstuvwxyz;c");
+
+        auto result = lexy::open_chunked_file(test_file_name, ';', 4);
+        REQUIRE(result);
+
+        auto file = LEXY_MOV(result).file();
+        REQUIRE(file.next_chunk());
+        CHECK(chunk_string(file) == "a;");
+        REQUIRE(file.next_chunk());
+        CHECK(chunk_string(file) == "bcdefghijklmnopqrstuvwxyz;");
+        REQUIRE(file.next_chunk());
+        CHECK(chunk_string(file) == "c");
+        CHECK(!file.next_chunk());
+    }
+    SUBCASE("big file")
+    {
+        {
+            auto file = std::fopen(test_file_name, "wb");
+            for (auto i = 0; i != 100 * 1024; ++i)
+                std::fputs("abc\n", file);
+            std::fclose(file);
+        }
+
+        auto result = lexy::open_chunked_file(test_file_name);
+        REQUIRE(result);
+
+        auto file  = LEXY_MOV(result).file();
+        auto lines = 0;
+        while (file.next_chunk())
+        {
+            // Every chunk consists of complete lines and fits into a block.
+            CHECK(file.size() <= 64 * 1024);
+            CHECK(file.size() % 4 == 0);
+            lines += int(file.size() / 4);
+        }
+        CHECK(file.error() == lexy::file_error::_success);
+        CHECK(lines == 100 * 1024);
+    }
+    SUBCASE("UTF-8 with BOM")
+    {
+        write_test_data("\xEF\xBB\xBF"
+                        "abc");
+
+        auto result = lexy::open_chunked_file<lexy::utf8_encoding>(test_file_name);
+        REQUIRE(result);
+
+        auto file = LEXY_MOV(result).file();
+        REQUIRE(file.next_chunk());
+        CHECK(file.size() == 3);
+
+        auto reader = file.reader();
+        CHECK(reader.peek() == 'a');
+        CHECK(!reader.eof());
+    }
+    SUBCASE("UTF-8 with BOM, small blocks")
+    {
+        write_test_data("\xEF\xBB\xBF"
+                        "a\n");
+
+        auto result = lexy::open_chunked_file<lexy::utf8_encoding>(test_file_name, '\n', 2);
+        REQUIRE(result);
+
+        auto file = LEXY_MOV(result).file();
+        REQUIRE(file.next_chunk());
+        CHECK(std::string(reinterpret_cast<const char*>(file.data()), file.size()) == "a\n");
+        CHECK(!file.next_chunk());
+    }
+    SUBCASE("UTF-8 with U+FEFF after the first chunk")
+    {
+        write_test_data("a\n\xEF\xBB\xBF"
+                        "b\n");
+
+        auto result = lexy::open_chunked_file<lexy::utf8_encoding>(test_file_name, '\n', 2);
+        REQUIRE(result);
+
+        auto file = LEXY_MOV(result).file();
+        REQUIRE(file.next_chunk());
+        CHECK(std::string(reinterpret_cast<const char*>(file.data()), file.size()) == "a\n");
+        REQUIRE(file.next_chunk());
+        CHECK(std::string(reinterpret_cast<const char*>(file.data()), file.size())
+              == "\xEF\xBB\xBF"
+                 "b\n");
+        CHECK(!file.next_chunk());
+    }
+
+    std::remove(test_file_name);
+}
+
 TEST_CASE("read_stdin")
 {
     // Here, we'll reassociate stdin with our test file.
@@ -0,0 +1,102 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <lexy/input/push_input.hpp>
+
+#include <doctest/doctest.h>
+#include <string>
+
+namespace
+{
+template <typename Input>
+std::string chunk_string(const Input& input)
+{
+    return std::string(reinterpret_cast<const char*>(input.data()), input.size());
+}
+} // namespace
+
+TEST_CASE("push_input")
+{
+    SUBCASE("empty")
+    {
+        lexy::push_input<> input;
+        CHECK(!input.next_chunk());
+        CHECK(!input.is_finished());
+
+        input.finish();
+        CHECK(input.is_finished());
+        CHECK(!input.next_chunk());
+    }
+    SUBCASE("complete records")
+    {
+        lexy::push_input<> input;
+        input.feed("abc\ndef\n", 8);
+
+        REQUIRE(input.next_chunk());
+        CHECK(chunk_string(input) == "abc\ndef\n");
+
+        auto reader = input.reader();
+        CHECK(reader.cur() == input.data());
+        CHECK(reader.peek() == 'a');
+        CHECK(!reader.eof());
+
+        CHECK(!input.next_chunk());
+        input.finish();
+        CHECK(!input.next_chunk());
+    }
+    SUBCASE("partial records")
+    {
+        lexy::push_input<> input;
+        input.feed("ab", 2);
+        CHECK(!input.next_chunk());
+
+        input.feed("c\nde", 4);
+        REQUIRE(input.next_chunk());
+        CHECK(chunk_string(input) == "abc\n");
+        CHECK(!input.next_chunk());
+
+        input.feed("f", 1);
+        CHECK(!input.next_chunk());
+        input.feed("\ng\nh", 4);
+        REQUIRE(input.next_chunk());
+        CHECK(chunk_string(input) == "def\ng\n");
+        CHECK(!input.next_chunk());
+
+        input.finish();
+        REQUIRE(input.next_chunk());
+        CHECK(chunk_string(input) == "h");
+        CHECK(!input.next_chunk());
+    }
+    SUBCASE("record bigger than block")
+    {
+        lexy::push_input<> input(';', 4);
+        input.feed("a;bcdefghij", 11);
+
+        REQUIRE(input.next_chunk());
+        CHECK(chunk_string(input) == "a;");
+        CHECK(!input.next_chunk());
+
+        input.feed("klmnopqrstuvwxyz;c", 18);
+        REQUIRE(input.next_chunk());
+        CHECK(chunk_string(input) == "bcdefghijklmnopqrstuvwxyz;");
+        CHECK(!input.next_chunk());
+
+        input.finish();
+        REQUIRE(input.next_chunk());
+        CHECK(chunk_string(input) == "c");
+    }
+    SUBCASE("custom encoding")
+    {
+        lexy::push_input<lexy::utf8_encoding> input;
+        input.feed("abc\n", 4);
+        input.feed(LEXY_CHAR8_STR("def\n"), 4);
+
+        REQUIRE(input.next_chunk());
+        CHECK(chunk_string(input) == "abc\ndef\n");
+
+        auto reader = input.reader();
+        CHECK(reader.peek() == 'a');
+    }
+}
+
@@ -0,0 +1,84 @@
+// Copyright (C) 2020-2021 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <lexy/input/validated_utf8_buffer.hpp>
+
+#include <doctest/doctest.h>
+
+namespace
+{
+template <std::size_t N>
+auto make_buffer(const char (&str)[N])
+{
+    return lexy::buffer<lexy::utf8_encoding>(reinterpret_cast<const LEXY_CHAR8_T*>(str), N - 1);
+}
+} // namespace
+
+TEST_CASE("validated_utf8_buffer")
+{
+    SUBCASE("valid")
+    {
+        auto check_valid = [](auto buffer) {
+            auto size      = buffer.size();
+            auto validated = lexy::validated_utf8_buffer(LEXY_MOV(buffer));
+            CHECK(validated);
+            CHECK(validated.buffer().size() == size);
+        };
+
+        check_valid(make_buffer(""));
+        check_valid(make_buffer("abc"));
+        check_valid(make_buffer("abcdefghijklmnopqrstuvwxyz"));
+        check_valid(make_buffer("abcdefghäbcdefgh€bcdefgh\U0001F642"));
+        check_valid(make_buffer("äöüäöüäöü"));
+        check_valid(make_buffer("퟿\U0010FFFF"));
+    }
+    SUBCASE("invalid")
+    {
+        auto error_position = [](auto buffer) {
+            auto data      = buffer.data();
+            auto validated = lexy::validated_utf8_buffer(LEXY_MOV(buffer));
+            REQUIRE(!validated);
+            return validated.error_position() - data;
+        };
+
+        CHECK(error_position(make_buffer("\x80")) == 0);
+        CHECK(error_position(make_buffer("abcdefghijk\x80")) == 11);
+        CHECK(error_position(make_buffer("abcdefgh\xC3")) == 8);
+        CHECK(error_position(make_buffer("abc\xC3\xA4\xC3x")) == 5);
+        CHECK(error_position(make_buffer("a\xC0\x80")) == 1);
+        CHECK(error_position(make_buffer("ab\xED\xA0\x80")) == 2);
+        CHECK(error_position(make_buffer("abc\xF4\x90\x80\x80")) == 3);
+        CHECK(error_position(make_buffer("abcdefghijklmnop\xFF")) == 16);
+    }
+    SUBCASE("reader")
+    {
+        auto validated
+            = lexy::validated_utf8_buffer(make_buffer("aä€\U0001F642abcdefgh"));
+        REQUIRE(validated);
+        CHECK(lexy::_is_validated_utf8_reader<decltype(validated.reader())>);
+        CHECK(!lexy::_is_validated_utf8_reader<decltype(validated.buffer().reader())>);
+        CHECK(lexy::_reader_padding<decltype(validated.reader())>
+              == lexy::_reader_padding<decltype(validated.buffer().reader())>);
+
+        auto reader = validated.reader();
+        auto parse  = [&] {
+            lexy::engine_cp_utf8::error_code ec{};
+            auto cp = lexy::engine_cp_utf8::parse(ec, reader);
+            CHECK(ec == lexy::engine_cp_utf8::error_code());
+            return cp.value();
+        };
+
+        CHECK(parse() == 'a');
+        CHECK(parse() == 0xE4);
+        CHECK(parse() == 0x20AC);
+        CHECK(parse() == 0x1F642);
+        for (auto c : {'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h'})
+            CHECK(parse() == char32_t(c));
+        CHECK(reader.eof());
+
+        lexy::engine_cp_utf8::error_code ec{};
+        lexy::engine_cp_utf8::parse(ec, reader);
+        CHECK(ec == lexy::engine_cp_utf8::error_code::eof);
+    }
+}